@@ -28,39 +28,14 @@ public class OVRLipSync : ModuleRules
 {
     public OVRLipSync(ReadOnlyTargetRules Target) : base(Target)
     {
-        PrivateDependencyModuleNames.AddRange(new string[] {"AndroidPermission"});
+        PrivateDependencyModuleNames.AddRange(new string[] {"AndroidPermission", "Projects", "Sockets"});
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
-        string BaseDirectory = Path.GetFullPath(Path.Combine(ModuleDirectory, "..", ".."));
-        string ThirdPartyDirectory = Path.Combine(BaseDirectory, "ThirdParty");
-        string PlatformString = Target.Platform.ToString();
-        string LibraryDirectory = Path.Combine(ThirdPartyDirectory, "Lib", PlatformString);
-        string TargetBinariesDirectory = Path.Combine(BaseDirectory, "Binaries", PlatformString);
-        PublicIncludePaths.Add(Path.Combine(ThirdPartyDirectory, "Include"));
-        PublicDependencyModuleNames.AddRange( new string[] { "Core", "CoreUObject", "Engine", "Voice", "AndroidPermission"});
+        PublicDependencyModuleNames.AddRange( new string[] { "Core", "CoreUObject", "Engine", "DeveloperSettings", "OVRLipSyncCore", "Voice", "AudioCaptureCore", "AndroidPermission"});
 
-        if (Target.Platform == UnrealTargetPlatform.Win64)
+        if (Target.Platform == UnrealTargetPlatform.Android)
         {
-            PublicAdditionalLibraries.Add(Path.Combine(LibraryDirectory, "OVRLipSyncShim.lib"));
-            PublicDelayLoadDLLs.Add("OVRLipSync.dll");
-            RuntimeDependencies.Add(Path.Combine(LibraryDirectory, "OVRLipSync.dll"), StagedFileType.NonUFS);
-        }
-        else if (Target.Platform == UnrealTargetPlatform.Mac)
-        {
-            PublicAdditionalLibraries.Add(Path.Combine(LibraryDirectory, "libOVRLipSyncShim.a"));
-            RuntimeDependencies.Add(Path.Combine(LibraryDirectory, "libOVRLipSync.dylib"), StagedFileType.NonUFS);
-        }
-        else if (Target.Platform == UnrealTargetPlatform.Android)
-        {
-            string Android64Directory = Path.Combine(ThirdPartyDirectory, "Lib", "Android", "arm64-v8a");
-            string Android32Directory = Path.Combine(ThirdPartyDirectory, "Lib", "Android", "armeabi-v7a");
-            PublicSystemLibraryPaths.Add(LibraryDirectory);
-            PublicSystemLibraryPaths.Add(Android32Directory);
-            PublicSystemLibraryPaths.Add(Android64Directory);
             AdditionalPropertiesForReceipt.Add("AndroidPlugin", Path.Combine(ModuleDirectory, "OVRLipSync_APL.xml"));
-            PublicAdditionalLibraries.Add(Path.Combine(Android32Directory, "libOVRLipSyncShim.a"));
-            PublicAdditionalLibraries.Add(Path.Combine(Android64Directory, "libOVRLipSyncShim.a"));
         }
-
     }
 }
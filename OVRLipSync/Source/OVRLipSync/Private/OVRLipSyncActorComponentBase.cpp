@@ -24,6 +24,7 @@
 #include "OVRLipSyncActorComponentBase.h"
 
 #include "Components/SkeletalMeshComponent.h"
+#include "Misc/ScopeLock.h"
 #include "OVRLipSyncModule.h"
 
 // Sets default values for this component's properties
@@ -31,6 +32,27 @@ UOVRLipSyncActorComponentBase::UOVRLipSyncActorComponentBase() { Visemes.Init(0.
 
 const TArray<float> &UOVRLipSyncActorComponentBase::GetVisemes() const { return Visemes; }
 
+FOVRLipSyncVisemeValues UOVRLipSyncActorComponentBase::GetVisemeValues() const
+{
+	FScopeLock Lock(&PredictionLock);
+	// Predictions of unexpected size read as the neutral pose
+	if (Visemes.Num() != FOVRLipSyncFrameData::VisemeCount)
+	{
+		FOVRLipSyncVisemeValues Values;
+		Values.Laughter = LaughterScore;
+		return Values;
+	}
+	return FOVRLipSyncVisemeValues::FromFrame(Visemes.GetData(), LaughterScore);
+}
+
+float UOVRLipSyncActorComponentBase::GetMouthOpen() const { return GetSummary().GetMouthOpen(); }
+
+FOVRLipSyncFrameSummary UOVRLipSyncActorComponentBase::GetSummary() const
+{
+	FScopeLock Lock(&PredictionLock);
+	return Summary;
+}
+
 const TArray<FString> &UOVRLipSyncActorComponentBase::GetVisemeNames() const { return VisemeNames; }
 
 const float UOVRLipSyncActorComponentBase::GetLaughterScore() const { return LaughterScore; }
@@ -56,19 +78,77 @@ void UOVRLipSyncActorComponentBase::AssignVisemesToMorphTargets(USkeletalMeshCom
 
 void UOVRLipSyncActorComponentBase::InitNeutralPose()
 {
-	if (LaughterScore == 0.0f && Visemes[0] == 1.0f)
 	{
-		return;
+		FScopeLock Lock(&PredictionLock);
+		const auto bIsNeutral = LaughterScore == 0.0f && Visemes[0] == 1.0f && Summary == FOVRLipSyncFrameSummary();
+		// A neutral prediction within BroadcastThreshold of the last broadcast one never reached listeners
+		const auto bListenersAreNeutral =
+			BroadcastThreshold <= 0.0f ||
+			(bHasBroadcast && LastBroadcastVisemes == Visemes && LastBroadcastLaughterScore == LaughterScore &&
+			 LastBroadcastSummary == Summary);
+		if (bIsNeutral && bListenersAreNeutral)
+		{
+			return;
+		}
+
+		LaughterScore = 0.0f;
+		Visemes[0] = 1.0f;
+		for (int idx = 1; idx < Visemes.Num(); ++idx)
+		{
+			Visemes[idx] = 0.0f;
+		}
+		Summary = FOVRLipSyncFrameSummary();
 	}
+	BroadcastVisemes(true);
+}
 
-	LaughterScore = 0.0f;
-	Visemes[0] = 1.0f;
-	for (int idx = 1; idx < Visemes.Num(); ++idx)
+void UOVRLipSyncActorComponentBase::BroadcastVisemes(bool bForce)
+{
 	{
-		Visemes[idx] = 0.0f;
+		FScopeLock Lock(&PredictionLock);
+		if (!bForce && BroadcastThreshold > 0.0f && bHasBroadcast && !HasChangedSinceBroadcast())
+		{
+			++NumSuppressedBroadcasts;
+			return;
+		}
+		if (BroadcastThreshold > 0.0f)
+		{
+			LastBroadcastVisemes = Visemes;
+			LastBroadcastLaughterScore = LaughterScore;
+			LastBroadcastSummary = Summary;
+			bHasBroadcast = true;
+		}
 	}
+	++NumBroadcasts;
+	OnVisemesReadyNative.Broadcast(this);
 	OnVisemesReady.Broadcast();
 }
+
+bool UOVRLipSyncActorComponentBase::HasChangedSinceBroadcast() const
+{
+	// Summary only playback leaves visemes alone, so the summary is compared as well
+	const auto SummaryThreshold = BroadcastThreshold * 255.0f;
+	if (Summary.DominantViseme != LastBroadcastSummary.DominantViseme ||
+		FMath::Abs(Summary.MouthOpen - LastBroadcastSummary.MouthOpen) > SummaryThreshold ||
+		FMath::Abs(Summary.Energy - LastBroadcastSummary.Energy) > SummaryThreshold ||
+		FMath::Abs(Summary.Laughter - LastBroadcastSummary.Laughter) > SummaryThreshold)
+	{
+		return true;
+	}
+	if (FMath::Abs(LaughterScore - LastBroadcastLaughterScore) > BroadcastThreshold ||
+		Visemes.Num() != LastBroadcastVisemes.Num())
+	{
+		return true;
+	}
+	for (int32 Idx = 0; Idx < Visemes.Num(); ++Idx)
+	{
+		if (FMath::Abs(Visemes[Idx] - LastBroadcastVisemes[Idx]) > BroadcastThreshold)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 const TArray<FString> UOVRLipSyncActorComponentBase::VisemeNames = {
 	FString(TEXT("sil")), FString(TEXT("PP")), FString(TEXT("FF")), FString(TEXT("TH")), FString(TEXT("DD")),
 	FString(TEXT("kk")),  FString(TEXT("CH")), FString(TEXT("SS")), FString(TEXT("nn")), FString(TEXT("RR")),
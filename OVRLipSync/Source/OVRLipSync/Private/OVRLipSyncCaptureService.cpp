@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncCaptureService.cpp
+ * Content     :   OVRLipSync shared capture service
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncCaptureService.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "OVRLipSyncModule.h"
+#include "VoiceModule.h"
+
+namespace
+{
+// Time the device thread sleeps when there is no audio to read
+constexpr float PollIntervalSeconds = 0.005f;
+
+FAutoConsoleCommand DumpCaptureStatsCommand(TEXT("OVRLipSync.DumpCaptureStats"),
+											TEXT("Logs latency stats of the shared capture devices"),
+											FConsoleCommandDelegate::CreateLambda(
+												[]() { FOVRLipSyncCaptureService::Get().DumpStats(); }));
+} // namespace
+
+class FOVRLipSyncCaptureService::FDevice : public FRunnable
+{
+public:
+	FDevice(const FString &InDeviceName, int32 InSampleRate, TSharedPtr<IVoiceCapture> InVoiceCapture)
+		: DeviceName(InDeviceName), SampleRate(InSampleRate), VoiceCapture(InVoiceCapture)
+	{
+		Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("OVRLipSyncCapture %s"), *DeviceName), 0,
+										 TPri_AboveNormal);
+	}
+
+	virtual ~FDevice()
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+		VoiceCapture->Stop();
+		VoiceCapture->Shutdown();
+	}
+
+	void AddSubscriber(FDelegateHandle Handle, int32 SubscriberSampleRate, FOnCapturedAudio OnCapturedAudio)
+	{
+		FScopeLock Lock(&SubscribersLock);
+		auto &Subscriber = Subscribers.Add(Handle);
+		Subscriber.OnCapturedAudio = MoveTemp(OnCapturedAudio);
+		Subscriber.SampleRate = SubscriberSampleRate;
+	}
+
+	bool RemoveSubscriber(FDelegateHandle Handle)
+	{
+		FScopeLock Lock(&SubscribersLock);
+		return Subscribers.Remove(Handle) > 0;
+	}
+
+	bool HasSubscribers() const
+	{
+		FScopeLock Lock(&SubscribersLock);
+		return Subscribers.Num() > 0;
+	}
+
+	FOVRLipSyncCaptureDeviceStats GetStats() const
+	{
+		FScopeLock Lock(&SubscribersLock);
+		auto Result = Stats;
+		Result.NumSubscribers = Subscribers.Num();
+		return Result;
+	}
+
+	const FString &GetDeviceName() const { return DeviceName; }
+	int32 GetSampleRate() const { return SampleRate; }
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			if (!Poll())
+			{
+				FPlatformProcess::Sleep(PollIntervalSeconds);
+			}
+		}
+		return 0;
+	}
+
+	virtual void Stop() override { bStopping = true; }
+
+private:
+	struct FSubscriber
+	{
+		FOnCapturedAudio OnCapturedAudio;
+		int32 SampleRate = 0;
+		// Resampler state, position of the next output sample in the next device buffer, where -1 is the last
+		// sample of the previous buffer
+		double Position = -1.0;
+		int16 LastSample = 0;
+		TArray<int16> Resampled;
+	};
+
+	// Linearly resamples a device buffer to the subscriber rate, continuing from the previous buffer
+	void Resample(FSubscriber &Subscriber, const int16 *Samples, int32 NumSamples) const
+	{
+		const auto Step = static_cast<double>(SampleRate) / Subscriber.SampleRate;
+		auto &Resampled = Subscriber.Resampled;
+		// Keeps its allocation, so steady state capture doesn't allocate
+		Resampled.Reset();
+		auto Position = Subscriber.Position;
+		while (Position < NumSamples - 1)
+		{
+			const auto Idx = FMath::FloorToInt(Position);
+			const auto Before = static_cast<float>(Idx < 0 ? Subscriber.LastSample : Samples[Idx]);
+			const auto After = static_cast<float>(Samples[Idx + 1]);
+			const auto Alpha = static_cast<float>(Position - Idx);
+			Resampled.Add(static_cast<int16>(FMath::RoundToInt(FMath::Lerp(Before, After, Alpha))));
+			Position += Step;
+		}
+		Subscriber.Position = Position - NumSamples;
+		Subscriber.LastSample = Samples[NumSamples - 1];
+	}
+
+	// Reads available audio and delivers it to subscribers, returns false if there was nothing to read
+	bool Poll()
+	{
+		uint32 AvailableBytes = 0;
+		auto CaptureState = VoiceCapture->GetCaptureState(AvailableBytes);
+		if (CaptureState == EVoiceCaptureState::UnInitialized)
+		{
+			if (!VoiceCapture->Init(DeviceName, SampleRate, 1) || !VoiceCapture->Start())
+			{
+				UE_LOG(LogOvrLipSync, Log, TEXT("Unsuccessfully tried to restart capture device %s."), *DeviceName);
+			}
+			return false;
+		}
+		if (CaptureState != EVoiceCaptureState::Ok || AvailableBytes == 0)
+		{
+			return false;
+		}
+
+		// The buffer only grows, so steady state capture doesn't allocate
+		if (static_cast<uint32>(Buffer.Num()) < AvailableBytes)
+		{
+			Buffer.SetNumUninitialized(AvailableBytes);
+		}
+		uint32 CapturedBytes = 0;
+		CaptureState = VoiceCapture->GetVoiceData(Buffer.GetData(), AvailableBytes, CapturedBytes);
+		if (CaptureState != EVoiceCaptureState::Ok || CapturedBytes < sizeof(int16))
+		{
+			return false;
+		}
+
+		const auto *Samples = reinterpret_cast<const int16 *>(Buffer.GetData());
+		const auto NumSamples = static_cast<int32>(CapturedBytes / sizeof(int16));
+		const auto BufferMs = 1000.0f * NumSamples / SampleRate;
+
+		FScopeLock Lock(&SubscribersLock);
+		const auto StartTime = FPlatformTime::Seconds();
+		for (auto &Subscriber : Subscribers)
+		{
+			if (Subscriber.Value.SampleRate == SampleRate)
+			{
+				Subscriber.Value.OnCapturedAudio(Samples, NumSamples);
+				continue;
+			}
+			Resample(Subscriber.Value, Samples, NumSamples);
+			if (Subscriber.Value.Resampled.Num() > 0)
+			{
+				Subscriber.Value.OnCapturedAudio(Subscriber.Value.Resampled.GetData(),
+												 Subscriber.Value.Resampled.Num());
+			}
+		}
+		const auto FanOutMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		++Stats.NumBuffers;
+		Stats.NumSamples += NumSamples;
+		Stats.AverageBufferMs += (BufferMs - Stats.AverageBufferMs) / Stats.NumBuffers;
+		Stats.MaxBufferMs = FMath::Max(Stats.MaxBufferMs, BufferMs);
+		Stats.AverageFanOutMs += (FanOutMs - Stats.AverageFanOutMs) / Stats.NumBuffers;
+		Stats.MaxFanOutMs = FMath::Max(Stats.MaxFanOutMs, FanOutMs);
+		return true;
+	}
+
+	FString DeviceName;
+	int32 SampleRate;
+	TSharedPtr<IVoiceCapture> VoiceCapture;
+	FRunnableThread *Thread = nullptr;
+	TAtomic<bool> bStopping{false};
+
+	TArray<uint8> Buffer;
+	// Guards subscribers and stats, held while audio is delivered
+	mutable FCriticalSection SubscribersLock;
+	TMap<FDelegateHandle, FSubscriber> Subscribers;
+	FOVRLipSyncCaptureDeviceStats Stats;
+};
+
+FOVRLipSyncCaptureService &FOVRLipSyncCaptureService::Get()
+{
+	static FOVRLipSyncCaptureService Service;
+	return Service;
+}
+
+FOVRLipSyncCaptureService::~FOVRLipSyncCaptureService() { Shutdown(); }
+
+FDelegateHandle FOVRLipSyncCaptureService::Subscribe(const FString &DeviceName, int32 SampleRate,
+													 FOnCapturedAudio OnCapturedAudio)
+{
+	FScopeLock Lock(&DevicesLock);
+	auto *Device = Devices.Find(DeviceName);
+	if (!Device)
+	{
+		auto VoiceCapture = FVoiceModule::Get().CreateVoiceCapture(DeviceName, SampleRate, 1);
+		if (!VoiceCapture || !VoiceCapture->Start())
+		{
+			UE_LOG(LogOvrLipSync, Error, TEXT("Can't open capture device '%s' at %d Hz"), *DeviceName, SampleRate);
+			return FDelegateHandle();
+		}
+		UE_LOG(LogOvrLipSync, Log, TEXT("Opened shared capture device '%s' at %d Hz"), *DeviceName, SampleRate);
+		Device = &Devices.Add(DeviceName, MakeShared<FDevice>(DeviceName, SampleRate, VoiceCapture));
+	}
+	else if ((*Device)->GetSampleRate() != SampleRate)
+	{
+		UE_LOG(LogOvrLipSync, Log, TEXT("Resampling shared capture device '%s' from %d Hz to %d Hz"), *DeviceName,
+			   (*Device)->GetSampleRate(), SampleRate);
+	}
+
+	FDelegateHandle Handle(FDelegateHandle::GenerateNewHandle);
+	(*Device)->AddSubscriber(Handle, SampleRate, MoveTemp(OnCapturedAudio));
+	return Handle;
+}
+
+void FOVRLipSyncCaptureService::Unsubscribe(FDelegateHandle Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+	FScopeLock Lock(&DevicesLock);
+	for (auto It = Devices.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->RemoveSubscriber(Handle))
+		{
+			if (!It.Value()->HasSubscribers())
+			{
+				UE_LOG(LogOvrLipSync, Log, TEXT("Closing shared capture device '%s'"), *It.Value()->GetDeviceName());
+				It.RemoveCurrent();
+			}
+			return;
+		}
+	}
+}
+
+bool FOVRLipSyncCaptureService::GetDeviceStats(const FString &DeviceName, FOVRLipSyncCaptureDeviceStats &OutStats) const
+{
+	FScopeLock Lock(&DevicesLock);
+	const auto *Device = Devices.Find(DeviceName);
+	if (!Device)
+	{
+		return false;
+	}
+	OutStats = (*Device)->GetStats();
+	return true;
+}
+
+void FOVRLipSyncCaptureService::DumpStats() const
+{
+	FScopeLock Lock(&DevicesLock);
+	UE_LOG(LogOvrLipSync, Display, TEXT("%d shared capture devices open"), Devices.Num());
+	for (const auto &Device : Devices)
+	{
+		const auto Stats = Device.Value->GetStats();
+		UE_LOG(LogOvrLipSync, Display,
+			   TEXT("  '%s' %d Hz: %d subscribers, %llu buffers, buffer avg %.2fms max %.2fms, fan-out avg %.3fms "
+					"max %.3fms"),
+			   *Device.Value->GetDeviceName(), Device.Value->GetSampleRate(), Stats.NumSubscribers, Stats.NumBuffers,
+			   Stats.AverageBufferMs, Stats.MaxBufferMs, Stats.AverageFanOutMs, Stats.MaxFanOutMs);
+	}
+}
+
+void FOVRLipSyncCaptureService::Shutdown()
+{
+	FScopeLock Lock(&DevicesLock);
+	Devices.Empty();
+}
@@ -22,126 +22,32 @@
  ******************************************************************************/
 
 #include "OVRLipSyncDecode.h"
-#include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncGenerator.h"
+#include "OVRLipSyncWav.h"
 #include "Sound/SoundWave.h"
 #include "Sound/SoundWaveProcedural.h"
 #include "AudioDevice.h"
+#include "Async/Async.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogOVRLipSyncDecode, Log, All);
 
 namespace
 {
-	// Compute LipSync sequence frames at 100 times a second rate
-	constexpr auto LipSyncSequenceUpdateFrequency = 100;
-	constexpr auto LipSyncSequenceDuration = 1.0f / LipSyncSequenceUpdateFrequency;
-
-	// WAV file format constants
-	struct FWavHeader
-	{
-		char RIFF[4];        // "RIFF"
-		uint32 ChunkSize;
-		char WAVE[4];        // "WAVE"
-		char fmt[4];         // "fmt "
-		uint32 Subchunk1Size;
-		uint16 AudioFormat;  // 1 = PCM
-		uint16 NumChannels;
-		uint32 SampleRate;
-		uint32 ByteRate;
-		uint16 BlockAlign;
-		uint16 BitsPerSample;
-	};
-
-	struct FWavDataHeader
-	{
-		char data[4];        // "data"
-		uint32 DataSize;
-	};
-}
+// Sound waves HexToSoundWave allocated RawPCMData for, the only ones ReleasePCMData frees. Game thread only.
+TSet<TWeakObjectPtr<USoundWave>> HexSoundWaves;
+} // namespace
 
 bool UOVRLipSyncDecode::ParseWavHeader(const TArray<uint8>& WavData, uint32& OutSampleRate, uint16& OutNumChannels, uint32& OutPCMDataOffset, uint32& OutPCMDataSize)
 {
-	const int32 MinWavSize = static_cast<int32>(sizeof(FWavHeader) + sizeof(FWavDataHeader));
-	if (WavData.Num() < MinWavSize)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] WAV data too small: %d bytes"), static_cast<int32>(WavData.Num()));
-		return false;
-	}
-
-	// Parse WAV header
-	const FWavHeader* Header = reinterpret_cast<const FWavHeader*>(WavData.GetData());
-
-	// Validate RIFF header
-	if (FMemory::Memcmp(Header->RIFF, "RIFF", 4) != 0)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Invalid RIFF header"));
-		return false;
-	}
-
-	// Validate WAVE format
-	if (FMemory::Memcmp(Header->WAVE, "WAVE", 4) != 0)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Invalid WAVE format"));
-		return false;
-	}
-
-	// Validate fmt chunk
-	if (FMemory::Memcmp(Header->fmt, "fmt ", 4) != 0)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Invalid fmt chunk"));
-		return false;
-	}
-
-	// Validate PCM format
-	if (Header->AudioFormat != 1)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Unsupported audio format: %u (only PCM is supported)"), Header->AudioFormat);
-		return false;
-	}
-
-	// Validate bits per sample
-	if (Header->BitsPerSample != 16)
-	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Unsupported bits per sample: %u (only 16-bit is supported)"), Header->BitsPerSample);
-		return false;
-	}
-
-	// Find data chunk
-	uint32 Offset = static_cast<uint32>(sizeof(FWavHeader));
-	bool bFoundDataChunk = false;
-
-	while (Offset + static_cast<uint32>(sizeof(FWavDataHeader)) <= static_cast<uint32>(WavData.Num()))
-	{
-		const FWavDataHeader* DataHeader = reinterpret_cast<const FWavDataHeader*>(WavData.GetData() + Offset);
-
-		if (FMemory::Memcmp(DataHeader->data, "data", 4) == 0)
-		{
-			OutPCMDataOffset = Offset + static_cast<uint32>(sizeof(FWavDataHeader));
-			OutPCMDataSize = DataHeader->DataSize;
-			bFoundDataChunk = true;
-			break;
-		}
-
-		// Skip this chunk and move to next
-		Offset += 8; // chunk ID (4) + chunk size field (4)
-		if (Offset + 4 <= static_cast<uint32>(WavData.Num()))
-		{
-			uint32 ChunkSize = *reinterpret_cast<const uint32*>(WavData.GetData() + Offset - 4);
-			Offset += ChunkSize;
-		}
-		else
-		{
-			break;
-		}
-	}
-
-	if (!bFoundDataChunk)
+	FOVRLipSyncWavInfo Info;
+	if (!FOVRLipSyncWav::ParseHeader(WavData, Info))
 	{
-		UE_LOG(LogOVRLipSyncDecode, Error, TEXT("[ParseWavHeader] Data chunk not found"));
 		return false;
 	}
-
-	OutSampleRate = Header->SampleRate;
-	OutNumChannels = Header->NumChannels;
+	OutSampleRate = Info.SampleRate;
+	OutNumChannels = Info.NumChannels;
+	OutPCMDataOffset = Info.PCMDataOffset;
+	OutPCMDataSize = Info.PCMDataSize;
 
 	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[ParseWavHeader] Success - Sample Rate: %u, Channels: %u, PCM Data Size: %u bytes"),
 		OutSampleRate, OutNumChannels, OutPCMDataSize);
@@ -226,6 +132,14 @@ bool UOVRLipSyncDecode::HexToSoundWave(const FString& HexWavData, USoundWave*& O
 	ProceduralWave->QueueAudio(WavData.GetData() + PCMDataOffset, PCMDataSize);
 
 	OutSoundWave = ProceduralWave;
+	for (auto It = HexSoundWaves.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	HexSoundWaves.Add(ProceduralWave);
 
 	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[HexToSoundWave] SoundWaveProcedural created successfully - Duration: %.2f seconds"), ProceduralWave->Duration);
 
@@ -251,7 +165,21 @@ bool UOVRLipSyncDecode::DecompressSoundWaveRuntime(USoundWave* SoundWave)
 	return false;
 }
 
-bool UOVRLipSyncDecode::GenerateLipSyncSequenceRuntime(USoundWave* SoundWave, bool UseOfflineModel, UOVRLipSyncFrameSequence*& OutSequence)
+void UOVRLipSyncDecode::ReleasePCMData(USoundWave* SoundWave)
+{
+	// Waves of HexToSoundWave play from their queued audio, RawPCMData is only there for generation
+	if (!SoundWave || !HexSoundWaves.Contains(SoundWave) || !SoundWave->RawPCMData)
+	{
+		return;
+	}
+	HexSoundWaves.Remove(SoundWave);
+	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[ReleasePCMData] Released %u bytes of RawPCMData"), SoundWave->RawPCMDataSize);
+	FMemory::Free(SoundWave->RawPCMData);
+	SoundWave->RawPCMData = nullptr;
+	SoundWave->RawPCMDataSize = 0;
+}
+
+bool UOVRLipSyncDecode::GenerateLipSyncSequenceRuntime(USoundWave* SoundWave, bool UseOfflineModel, UOVRLipSyncFrameSequence*& OutSequence, float HopMs, float WindowMs, bool bReleasePCMData)
 {
 	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] Starting LipSync sequence generation"));
 
@@ -293,76 +221,109 @@ bool UOVRLipSyncDecode::GenerateLipSyncSequenceRuntime(USoundWave* SoundWave, bo
 		return false;
 	}
 
-	int32 NumChannels = static_cast<int32>(SoundWave->NumChannels);
-	int32 SampleRate = static_cast<int32>(SoundWave->GetSampleRateForCurrentPlatform());
-	int32 PCMDataSize = static_cast<int32>(SoundWave->RawPCMDataSize / sizeof(int16));
-	int16* PCMData = reinterpret_cast<int16*>(SoundWave->RawPCMData);
-	int32 ChunkSizeSamples = static_cast<int32>(static_cast<float>(SampleRate) * LipSyncSequenceDuration);
-	int32 ChunkSize = NumChannels * ChunkSizeSamples;
+	const int32 NumChannels = static_cast<int32>(SoundWave->NumChannels);
+	const int32 SampleRate = static_cast<int32>(SoundWave->GetSampleRateForCurrentPlatform());
+	// PCM data is read in place, no copy is made
+	const int32 PCMDataSize = static_cast<int32>(SoundWave->RawPCMDataSize / sizeof(int16));
+	const int16* PCMData = reinterpret_cast<const int16*>(SoundWave->RawPCMData);
 
 	// Setup model path for offline model if requested
-	FString ModelPath;
-	if (UseOfflineModel)
+	FOVRLipSyncGenerationSettings Settings;
+	Settings.SampleRate = SampleRate;
+	Settings.NumChannels = NumChannels;
+	Settings.HopMs = HopMs;
+	Settings.WindowMs = WindowMs;
+	Settings.ModelPath = UseOfflineModel ? FOVRLipSyncGenerator::GetOfflineModelPath() : FString();
+	if (!Settings.ModelPath.IsEmpty())
 	{
-		ModelPath = FPaths::Combine(FPaths::ProjectPluginsDir(), TEXT("OVRLipSync"), TEXT("OfflineModel"), TEXT("ovrlipsync_offline_model.pb"));
-		if (!FPaths::FileExists(ModelPath))
-		{
-			UE_LOG(LogOVRLipSyncDecode, Warning, TEXT("[GenerateLipSyncSequenceRuntime] Offline model not found at: %s"), *ModelPath);
-			ModelPath = FString();
-		}
-		else
-		{
-			UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] Using offline model: %s"), *ModelPath);
-		}
+		UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] Using offline model: %s"), *Settings.ModelPath);
 	}
 
-	// Create LipSync context
-	UOVRLipSyncContextWrapper Context(ovrLipSyncContextProvider_Enhanced, SampleRate, 4096, ModelPath);
-
-	float LaughterScore = 0.0f;
-	int32 FrameDelayInMs = 0;
-	TArray<float> Visemes;
+	FOVRLipSyncGenerator Generator(Settings);
+	OutSequence->FrameRate = Generator.GetFrameRate();
+	Generator.Generate(PCMData, PCMDataSize, OutSequence->Frames);
+	OutSequence->BuildSpeechIndex();
+	const int32 FrameCount = static_cast<int32>(OutSequence->Num());
+	if (bReleasePCMData)
+	{
+		ReleasePCMData(SoundWave);
+	}
 
-	// Initialize with zero samples to get frame delay
-	TArray<int16> Samples;
-	Samples.SetNumZeroed(ChunkSize);
-	Context.ProcessFrame(Samples.GetData(), ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs, NumChannels > 1);
+	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] LipSync sequence generated successfully - Total frames: %d"), FrameCount);
 
-	int32 FrameOffset = static_cast<int32>(FrameDelayInMs * SampleRate / 1000 * NumChannels);
+	return true;
+}
 
-	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] Processing frames - Total samples: %d, Frame offset: %d, Chunk size: %d"),
-		PCMDataSize, FrameOffset, ChunkSize);
+bool UOVRLipSyncDecode::GenerateLipSyncSequenceRuntimeTwoPass(USoundWave* SoundWave, UOVRLipSyncFrameSequence*& OutSequence, const FOVRLipSyncSequenceRefinedDelegate& OnRefined, float HopMs, float WindowMs, bool bReleasePCMData)
+{
+	// First pass: online provider, returns immediately usable sequence
+	if (!GenerateLipSyncSequenceRuntime(SoundWave, false, OutSequence, HopMs, WindowMs, false))
+	{
+		return false;
+	}
 
-	int32 FrameCount = 0;
-	for (int32 Offs = 0; Offs < PCMDataSize + FrameOffset; Offs += ChunkSize)
+	FOVRLipSyncGenerationSettings Settings;
+	Settings.ModelPath = FOVRLipSyncGenerator::GetOfflineModelPath();
+	if (Settings.ModelPath.IsEmpty())
 	{
-		int32 RemainingSamples = PCMDataSize - Offs;
-		if (RemainingSamples >= ChunkSize)
+		UE_LOG(LogOVRLipSyncDecode, Warning, TEXT("[GenerateLipSyncSequenceRuntimeTwoPass] Offline model unavailable, keeping provisional sequence"));
+		if (bReleasePCMData)
 		{
-			Context.ProcessFrame(PCMData + Offs, ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs, NumChannels > 1);
+			ReleasePCMData(SoundWave);
 		}
-		else
+		return true;
+	}
+
+	// Second pass works on its own copy of the PCM data, as SoundWave may be collected before it finishes.
+	// The copy is freed with the worker, so the one attached to the SoundWave can be released right away.
+	Settings.NumChannels = static_cast<int32>(SoundWave->NumChannels);
+	Settings.SampleRate = static_cast<int32>(SoundWave->GetSampleRateForCurrentPlatform());
+	Settings.HopMs = HopMs;
+	Settings.WindowMs = WindowMs;
+	TArray<int16> PCMData(reinterpret_cast<const int16*>(SoundWave->RawPCMData), static_cast<int32>(SoundWave->RawPCMDataSize / sizeof(int16)));
+	if (bReleasePCMData)
+	{
+		ReleasePCMData(SoundWave);
+	}
+	TWeakObjectPtr<UOVRLipSyncFrameSequence> WeakSequence(OutSequence);
+
+	Async(EAsyncExecution::ThreadPool, [PCMData = MoveTemp(PCMData), Settings, WeakSequence, OnRefined]()
+	{
+		FOVRLipSyncFrameData RefinedFrames;
+		FOVRLipSyncGenerator Generator(Settings);
+		Generator.Generate(PCMData.GetData(), PCMData.Num(), RefinedFrames);
+
+		// Playback reads frames on the game thread, so swapping there makes the update atomic for any
+		// frame that has not been played yet. Frames already played are never read again.
+		AsyncTask(ENamedThreads::GameThread, [RefinedFrames = MoveTemp(RefinedFrames), WeakSequence, OnRefined]() mutable
 		{
-			if (RemainingSamples > 0)
+			UOVRLipSyncFrameSequence* Sequence = WeakSequence.Get();
+			if (!Sequence)
 			{
-				FMemory::Memcpy(Samples.GetData(), PCMData + Offs, static_cast<SIZE_T>(sizeof(int16)) * RemainingSamples);
-				FMemory::Memset(Samples.GetData() + RemainingSamples, 0, static_cast<SIZE_T>(sizeof(int16)) * (ChunkSize - RemainingSamples));
+				UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntimeTwoPass] Sequence was released before refinement finished"));
+				return;
 			}
-			else
+			// Only the range the refinement covers is replaced, frames appended while it ran are kept
+			const int32 NumRefined = RefinedFrames.Num();
+			const int32 NumAppended = Sequence->Frames.Num() - NumRefined;
+			if (NumAppended > 0)
 			{
-				FMemory::Memset(Samples.GetData(), 0, static_cast<SIZE_T>(sizeof(int16)) * ChunkSize);
+				constexpr auto VisemeCount = FOVRLipSyncFrameData::VisemeCount;
+				RefinedFrames.Reserve(NumRefined + NumAppended);
+				RefinedFrames.Visemes.Append(Sequence->Frames.Visemes.GetData() + NumRefined * VisemeCount, NumAppended * VisemeCount);
+				RefinedFrames.LaughterScores.Append(Sequence->Frames.LaughterScores.GetData() + NumRefined, NumAppended);
 			}
-			Context.ProcessFrame(Samples.GetData(), ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs, NumChannels > 1);
-		}
-
-		if (Offs >= FrameOffset)
-		{
-			OutSequence->Add(Visemes, LaughterScore);
-			FrameCount++;
-		}
-	}
-
-	UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntime] LipSync sequence generated successfully - Total frames: %d"), FrameCount);
+			Sequence->Frames = MoveTemp(RefinedFrames);
+			Sequence->EncodedFrames = FOVRLipSyncEncodedFrames();
+			Sequence->BuildSpeechIndex();
+			if (Sequence->Levels.Num() > 0)
+			{
+				Sequence->BuildDecimatedLevels();
+			}
+			UE_LOG(LogOVRLipSyncDecode, Log, TEXT("[GenerateLipSyncSequenceRuntimeTwoPass] Refined sequence swapped in - Total frames: %d"), static_cast<int32>(Sequence->Num()));
+			OnRefined.ExecuteIfBound(Sequence);
+		});
+	});
 
 	return true;
 }
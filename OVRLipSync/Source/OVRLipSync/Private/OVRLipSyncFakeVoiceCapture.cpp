@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFakeVoiceCapture.cpp
+ * Content     :   OVRLipSync WAV replaying voice capture
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncFakeVoiceCapture.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "OVRLipSyncDecode.h"
+#include "OVRLipSyncModule.h"
+
+FOVRLipSyncFakeVoiceCapture::FOVRLipSyncFakeVoiceCapture(TArray<int16> InPCMData, int32 InSampleRate, EClock InClock,
+														 bool bInLoop)
+	: SourcePCMData(MoveTemp(InPCMData)), SourceSampleRate(InSampleRate), PCMData(SourcePCMData),
+	  SampleRate(InSampleRate), Clock(InClock), bLoop(bInLoop)
+{
+}
+
+TSharedPtr<FOVRLipSyncFakeVoiceCapture> FOVRLipSyncFakeVoiceCapture::CreateFromWavFile(const FString &FilePath,
+																						 EClock Clock, bool bLoop)
+{
+	TArray<uint8> WavData;
+	if (!FFileHelper::LoadFileToArray(WavData, *FilePath))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't read %s"), *FilePath);
+		return nullptr;
+	}
+	uint32 WavSampleRate = 0, PCMDataOffset = 0, PCMDataSize = 0;
+	uint16 NumChannels = 0;
+	if (!UOVRLipSyncDecode::ParseWavHeader(WavData, WavSampleRate, NumChannels, PCMDataOffset, PCMDataSize) ||
+		NumChannels == 0)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't parse %s"), *FilePath);
+		return nullptr;
+	}
+	// Tolerate data chunks whose size field overshoots the file
+	PCMDataSize = FMath::Min<uint32>(PCMDataSize, WavData.Num() - PCMDataOffset);
+
+	const auto *Samples = reinterpret_cast<const int16 *>(WavData.GetData() + PCMDataOffset);
+	const auto NumFrames = static_cast<int32>(PCMDataSize / sizeof(int16) / NumChannels);
+	TArray<int16> MonoData;
+	MonoData.SetNumUninitialized(NumFrames);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		int32 Sum = 0;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Sum += Samples[Frame * NumChannels + Channel];
+		}
+		MonoData[Frame] = static_cast<int16>(Sum / NumChannels);
+	}
+	return MakeShared<FOVRLipSyncFakeVoiceCapture>(MoveTemp(MonoData), WavSampleRate, Clock, bLoop);
+}
+
+void FOVRLipSyncFakeVoiceCapture::Advance(float DeltaSeconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	VirtualTime += DeltaSeconds;
+}
+
+bool FOVRLipSyncFakeVoiceCapture::IsFinished() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return !bLoop && NumSamplesDelivered >= PCMData.Num();
+}
+
+int64 FOVRLipSyncFakeVoiceCapture::GetNumSamplesDelivered() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumSamplesDelivered;
+}
+
+float FOVRLipSyncFakeVoiceCapture::GetDuration() const
+{
+	return SourceSampleRate > 0 ? static_cast<float>(SourcePCMData.Num()) / SourceSampleRate : 0.0f;
+}
+
+int64 FOVRLipSyncFakeVoiceCapture::GetNumSamplesAvailable() const
+{
+	if (!bCapturing)
+	{
+		return 0;
+	}
+	const auto Elapsed = Clock == EClock::RealTime ? FPlatformTime::Seconds() - StartTime : VirtualTime;
+	auto NumSamplesElapsed = static_cast<int64>(Elapsed * SampleRate);
+	if (!bLoop)
+	{
+		NumSamplesElapsed = FMath::Min<int64>(NumSamplesElapsed, PCMData.Num());
+	}
+	return FMath::Max<int64>(0, NumSamplesElapsed - NumSamplesDelivered);
+}
+
+bool FOVRLipSyncFakeVoiceCapture::Init(const FString &DeviceName, int32 InSampleRate, int32 NumChannels)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (InSampleRate <= 0 || SourceSampleRate <= 0)
+	{
+		return false;
+	}
+	SampleRate = InSampleRate;
+	if (SampleRate == SourceSampleRate)
+	{
+		PCMData = SourcePCMData;
+		return true;
+	}
+
+	// Linear resampling is plenty for driving the analyser in tests
+	const auto NumSamples = static_cast<int32>(static_cast<int64>(SourcePCMData.Num()) * SampleRate / SourceSampleRate);
+	const auto Step = static_cast<double>(SourceSampleRate) / SampleRate;
+	PCMData.SetNumUninitialized(NumSamples);
+	for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+	{
+		const auto Pos = Idx * Step;
+		const auto Left = FMath::Min(static_cast<int32>(Pos), SourcePCMData.Num() - 1);
+		const auto Right = FMath::Min(Left + 1, SourcePCMData.Num() - 1);
+		PCMData[Idx] = static_cast<int16>(FMath::Lerp<float>(SourcePCMData[Left], SourcePCMData[Right], Pos - Left));
+	}
+	return true;
+}
+
+void FOVRLipSyncFakeVoiceCapture::Shutdown() { Stop(); }
+
+bool FOVRLipSyncFakeVoiceCapture::Start()
+{
+	FScopeLock ScopeLock(&Lock);
+	bCapturing = PCMData.Num() > 0;
+	StartTime = FPlatformTime::Seconds();
+	VirtualTime = 0.0;
+	NumSamplesDelivered = 0;
+	return bCapturing;
+}
+
+void FOVRLipSyncFakeVoiceCapture::Stop()
+{
+	FScopeLock ScopeLock(&Lock);
+	bCapturing = false;
+}
+
+bool FOVRLipSyncFakeVoiceCapture::ChangeDevice(const FString &DeviceName, int32 InSampleRate, int32 NumChannels)
+{
+	return Init(DeviceName, InSampleRate, NumChannels);
+}
+
+bool FOVRLipSyncFakeVoiceCapture::IsCapturing()
+{
+	FScopeLock ScopeLock(&Lock);
+	return bCapturing;
+}
+
+EVoiceCaptureState::Type FOVRLipSyncFakeVoiceCapture::GetCaptureState(uint32 &OutAvailableVoiceData) const
+{
+	FScopeLock ScopeLock(&Lock);
+	OutAvailableVoiceData = static_cast<uint32>(GetNumSamplesAvailable() * sizeof(int16));
+	if (!bCapturing)
+	{
+		return EVoiceCaptureState::NotCapturing;
+	}
+	return OutAvailableVoiceData > 0 ? EVoiceCaptureState::Ok : EVoiceCaptureState::NoData;
+}
+
+EVoiceCaptureState::Type FOVRLipSyncFakeVoiceCapture::GetVoiceData(uint8 *OutVoiceBuffer, uint32 InVoiceBufferSize,
+																   uint32 &OutAvailableVoiceData)
+{
+	uint64 SampleCounter = 0;
+	return GetVoiceData(OutVoiceBuffer, InVoiceBufferSize, OutAvailableVoiceData, SampleCounter);
+}
+
+EVoiceCaptureState::Type FOVRLipSyncFakeVoiceCapture::GetVoiceData(uint8 *OutVoiceBuffer, uint32 InVoiceBufferSize,
+																   uint32 &OutAvailableVoiceData,
+																   uint64 &OutSampleCounter)
+{
+	FScopeLock ScopeLock(&Lock);
+	OutAvailableVoiceData = 0;
+	OutSampleCounter = NumSamplesDelivered;
+	if (!bCapturing)
+	{
+		return EVoiceCaptureState::NotCapturing;
+	}
+	const auto NumSamples = FMath::Min<int64>(GetNumSamplesAvailable(), InVoiceBufferSize / sizeof(int16));
+	if (NumSamples == 0)
+	{
+		return EVoiceCaptureState::NoData;
+	}
+
+	auto *OutSamples = reinterpret_cast<int16 *>(OutVoiceBuffer);
+	for (int64 Copied = 0; Copied < NumSamples;)
+	{
+		// Looping audio wraps around, so copy up to the end of the data at a time
+		const auto Offset = static_cast<int32>(NumSamplesDelivered % PCMData.Num());
+		const auto NumCopied = FMath::Min<int64>(NumSamples - Copied, PCMData.Num() - Offset);
+		FMemory::Memcpy(OutSamples + Copied, PCMData.GetData() + Offset, NumCopied * sizeof(int16));
+		Copied += NumCopied;
+		NumSamplesDelivered += NumCopied;
+	}
+	OutAvailableVoiceData = static_cast<uint32>(NumSamples * sizeof(int16));
+	return EVoiceCaptureState::Ok;
+}
+
+int32 FOVRLipSyncFakeVoiceCapture::GetBufferSize() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PCMData.Num() * sizeof(int16);
+}
+
+void FOVRLipSyncFakeVoiceCapture::DumpState() const
+{
+	FScopeLock ScopeLock(&Lock);
+	UE_LOG(LogOvrLipSync, Display, TEXT("Fake voice capture: %s clock, %d Hz, %lld of %d samples delivered%s"),
+		   Clock == EClock::RealTime ? TEXT("real time") : TEXT("virtual"), SampleRate, NumSamplesDelivered,
+		   PCMData.Num(), bLoop ? TEXT(", looping") : TEXT(""));
+}
@@ -0,0 +1,543 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFrame.cpp
+ * Content     :   OVRLipSync Frame Sequence
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncFrame.h"
+
+#include "Algo/BinarySearch.h"
+#include "OVRLipSyncFrameCodec.h"
+#include "OVRLipSyncModule.h"
+#include "OVRLipSyncSettings.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "Interfaces/ITargetPlatform.h"
+#endif
+
+void FOVRLipSyncFrameData::Reserve(int32 NumFrames)
+{
+	Visemes.Reserve(NumFrames * VisemeCount);
+	LaughterScores.Reserve(NumFrames);
+}
+
+void FOVRLipSyncFrameData::Add(const float *FrameVisemes, float LaughterScore)
+{
+	Visemes.Append(FrameVisemes, VisemeCount);
+	LaughterScores.Add(LaughterScore);
+}
+
+void FOVRLipSyncFrameData::Append(const FOVRLipSyncFrameData &Other, int32 CrossfadeFrames)
+{
+	// Appending frames to themselves would read arrays while they grow
+	if (&Other == this)
+	{
+		const auto Copy = Other;
+		Append(Copy, CrossfadeFrames);
+		return;
+	}
+	const auto Boundary = Num();
+	Reserve(Boundary + Other.Num());
+	Visemes.Append(Other.Visemes);
+	LaughterScores.Append(Other.LaughterScores);
+
+	CrossfadeFrames = FMath::Min3(CrossfadeFrames, Boundary, Other.Num());
+	if (CrossfadeFrames <= 0)
+	{
+		return;
+	}
+
+	// Frames around the boundary fade from the last frame before it to the first frame after it,
+	// each frame being blended with the edge frame of the opposite side
+	float LastBefore[VisemeCount + 1], FirstAfter[VisemeCount + 1];
+	FMemory::Memcpy(LastBefore, &Visemes[(Boundary - 1) * VisemeCount], VisemeCount * sizeof(float));
+	FMemory::Memcpy(FirstAfter, &Visemes[Boundary * VisemeCount], VisemeCount * sizeof(float));
+	LastBefore[VisemeCount] = LaughterScores[Boundary - 1];
+	FirstAfter[VisemeCount] = LaughterScores[Boundary];
+
+	for (int32 Offset = -CrossfadeFrames; Offset < CrossfadeFrames; ++Offset)
+	{
+		const auto Alpha = (Offset + CrossfadeFrames + 0.5f) / (2 * CrossfadeFrames);
+		const auto Idx = Boundary + Offset;
+		float *FrameVisemes = &Visemes[Idx * VisemeCount];
+		const float *Edge = Offset < 0 ? FirstAfter : LastBefore;
+		const auto EdgeWeight = Offset < 0 ? Alpha : 1.0f - Alpha;
+		for (int32 VisemeIdx = 0; VisemeIdx < VisemeCount; ++VisemeIdx)
+		{
+			FrameVisemes[VisemeIdx] = FMath::Lerp(FrameVisemes[VisemeIdx], Edge[VisemeIdx], EdgeWeight);
+		}
+		LaughterScores[Idx] = FMath::Lerp(LaughterScores[Idx], Edge[VisemeCount], EdgeWeight);
+	}
+}
+
+namespace
+{
+// Frames with energy above this are speech
+constexpr float SpeechEnergyThreshold = 0.5f;
+// Pauses shorter than this are part of the surrounding speech segment
+constexpr float MinSilenceSeconds = 0.15f;
+// Speech shorter than this is treated as noise
+constexpr float MinSpeechSeconds = 0.05f;
+
+// How far each viseme opens the jaw: sil, PP, FF, TH, DD, kk, CH, SS, nn, RR, aa, E, ih, oh, ou
+constexpr float MouthOpenWeights[FOVRLipSyncFrameData::VisemeCount] = {
+	0.0f, 0.0f, 0.1f, 0.25f, 0.3f, 0.35f, 0.3f, 0.2f, 0.25f, 0.4f, 1.0f, 0.7f, 0.5f, 0.8f, 0.5f};
+
+uint8 Quantize(float Value) { return FOVRLipSyncFrameCodec::Quantize(Value); }
+} // namespace
+
+void FOVRLipSyncFrameData::Decimate(int32 Factor, FOVRLipSyncFrameData &OutFrames) const
+{
+	FOVRLipSyncFrameCodec::Decimate(Visemes, LaughterScores, Factor, OutFrames.Visemes, OutFrames.LaughterScores);
+}
+
+void FOVRLipSyncEncodedFrames::Encode(const FOVRLipSyncFrameData &Frames, OVRLipSyncSequenceEncoding InEncoding,
+									  bool bStripLaughter, float KeyframeTolerance)
+{
+	*this = FOVRLipSyncEncodedFrames();
+	Encoding = InEncoding;
+	NumFrames = Frames.Num();
+	bHasLaughter = !bStripLaughter;
+
+	switch (Encoding)
+	{
+	case OVRLipSyncSequenceEncoding::Float:
+		FloatScores = Frames.Visemes;
+		if (bHasLaughter)
+		{
+			FloatScores.Append(Frames.LaughterScores);
+		}
+		break;
+	case OVRLipSyncSequenceEncoding::Quantized:
+		Scores.Reserve(NumFrames * (FOVRLipSyncFrameData::VisemeCount + 1));
+		for (auto Score : Frames.Visemes)
+		{
+			Scores.Add(Quantize(Score));
+		}
+		if (bHasLaughter)
+		{
+			for (auto Score : Frames.LaughterScores)
+			{
+				Scores.Add(Quantize(Score));
+			}
+		}
+		break;
+	case OVRLipSyncSequenceEncoding::Keyframed:
+		for (int32 Viseme = 0; Viseme < FOVRLipSyncFrameData::VisemeCount; ++Viseme)
+		{
+			NumKeys.Add(FOVRLipSyncFrameCodec::EncodeKeyframes(Frames.Visemes.GetData() + Viseme, NumFrames,
+															   FOVRLipSyncFrameData::VisemeCount, KeyframeTolerance,
+															   Scores, KeyGaps));
+		}
+		if (bHasLaughter)
+		{
+			NumKeys.Add(FOVRLipSyncFrameCodec::EncodeKeyframes(Frames.LaughterScores.GetData(), NumFrames, 1,
+															   KeyframeTolerance, Scores, KeyGaps));
+		}
+		break;
+	}
+}
+
+void FOVRLipSyncEncodedFrames::Decode(FOVRLipSyncFrameData &OutFrames) const
+{
+	const auto NumVisemeScores = NumFrames * FOVRLipSyncFrameData::VisemeCount;
+	OutFrames.Visemes.SetNumUninitialized(NumVisemeScores);
+	OutFrames.LaughterScores.SetNumZeroed(NumFrames);
+
+	switch (Encoding)
+	{
+	case OVRLipSyncSequenceEncoding::Float:
+		FMemory::Memcpy(OutFrames.Visemes.GetData(), FloatScores.GetData(), NumVisemeScores * sizeof(float));
+		if (bHasLaughter)
+		{
+			FMemory::Memcpy(OutFrames.LaughterScores.GetData(), FloatScores.GetData() + NumVisemeScores,
+							NumFrames * sizeof(float));
+		}
+		break;
+	case OVRLipSyncSequenceEncoding::Quantized:
+		for (int32 Idx = 0; Idx < NumVisemeScores; ++Idx)
+		{
+			OutFrames.Visemes[Idx] = FOVRLipSyncFrameCodec::Dequantize(Scores[Idx]);
+		}
+		if (bHasLaughter)
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				OutFrames.LaughterScores[Frame] = FOVRLipSyncFrameCodec::Dequantize(Scores[NumVisemeScores + Frame]);
+			}
+		}
+		break;
+	case OVRLipSyncSequenceEncoding::Keyframed:
+	{
+		auto FirstKey = 0;
+		for (int32 Channel = 0; Channel < NumKeys.Num(); ++Channel)
+		{
+			const auto bLaughter = Channel == FOVRLipSyncFrameData::VisemeCount;
+			FOVRLipSyncFrameCodec::DecodeKeyframes(
+				Scores.GetData() + FirstKey, KeyGaps.GetData() + FirstKey, NumKeys[Channel],
+				bLaughter ? OutFrames.LaughterScores.GetData() : OutFrames.Visemes.GetData() + Channel,
+				bLaughter ? 1 : FOVRLipSyncFrameData::VisemeCount);
+			FirstKey += NumKeys[Channel];
+		}
+		break;
+	}
+	}
+}
+
+FOVRLipSyncFrameSummary FOVRLipSyncFrameSummary::FromFrame(const float *FrameVisemes, float LaughterScore)
+{
+	FOVRLipSyncFrameSummary Summary;
+	float MouthOpen = 0.0f;
+	for (int32 Viseme = 0; Viseme < FOVRLipSyncFrameData::VisemeCount; ++Viseme)
+	{
+		MouthOpen += MouthOpenWeights[Viseme] * FrameVisemes[Viseme];
+		if (FrameVisemes[Viseme] > FrameVisemes[Summary.DominantViseme])
+		{
+			Summary.DominantViseme = static_cast<uint8>(Viseme);
+		}
+	}
+	Summary.MouthOpen = Quantize(MouthOpen);
+	// Viseme 0 is silence
+	Summary.Energy = Quantize(1.0f - FrameVisemes[0]);
+	Summary.Laughter = Quantize(LaughterScore);
+	return Summary;
+}
+
+FOVRLipSyncVisemeValues FOVRLipSyncVisemeValues::FromFrame(const float *FrameVisemes, float LaughterScore)
+{
+	static_assert(FOVRLipSyncFrameData::VisemeCount == 15, "Viseme fields have to match the viseme count");
+	FOVRLipSyncVisemeValues Values;
+	Values.Sil = FrameVisemes[0];
+	Values.PP = FrameVisemes[1];
+	Values.FF = FrameVisemes[2];
+	Values.TH = FrameVisemes[3];
+	Values.DD = FrameVisemes[4];
+	Values.KK = FrameVisemes[5];
+	Values.CH = FrameVisemes[6];
+	Values.SS = FrameVisemes[7];
+	Values.NN = FrameVisemes[8];
+	Values.RR = FrameVisemes[9];
+	Values.AA = FrameVisemes[10];
+	Values.E = FrameVisemes[11];
+	Values.IH = FrameVisemes[12];
+	Values.OH = FrameVisemes[13];
+	Values.OU = FrameVisemes[14];
+	Values.Laughter = LaughterScore;
+	return Values;
+}
+
+void FOVRLipSyncSpeechIndex::Build(const TArray<FOVRLipSyncFrameSummary> &Summaries, float FrameRate)
+{
+	const auto NumFrames = Summaries.Num();
+	SegmentStarts.Reset();
+	SegmentEnds.Reset();
+
+	const auto MinSilenceFrames = FMath::Max(1, FMath::RoundToInt(MinSilenceSeconds * FrameRate));
+	const auto MinSpeechFrames = FMath::Max(1, FMath::RoundToInt(MinSpeechSeconds * FrameRate));
+	const auto Threshold = Quantize(SpeechEnergyThreshold);
+	int32 Start = INDEX_NONE;
+	auto CloseSegment = [&](int32 End) {
+		if (SegmentEnds.Num() > 0 && Start - SegmentEnds.Last() < MinSilenceFrames)
+		{
+			SegmentEnds.Last() = End;
+		}
+		else if (End - Start >= MinSpeechFrames)
+		{
+			SegmentStarts.Add(Start);
+			SegmentEnds.Add(End);
+		}
+	};
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const auto Energy = Summaries[Frame].Energy;
+		if (Energy > Threshold && Start == INDEX_NONE)
+		{
+			Start = Frame;
+		}
+		else if (Energy <= Threshold && Start != INDEX_NONE)
+		{
+			CloseSegment(Frame);
+			Start = INDEX_NONE;
+		}
+	}
+	if (Start != INDEX_NONE)
+	{
+		CloseSegment(NumFrames);
+	}
+}
+
+int32 FOVRLipSyncSpeechIndex::FindSegment(int32 Frame) const
+{
+	const auto Idx = Algo::UpperBound(SegmentStarts, Frame) - 1;
+	return Idx >= 0 && Frame < SegmentEnds[Idx] ? Idx : INDEX_NONE;
+}
+
+int32 FOVRLipSyncSpeechIndex::FindNextSegment(int32 Frame) const
+{
+	const auto Idx = Algo::LowerBound(SegmentStarts, Frame);
+	return Idx < SegmentStarts.Num() ? Idx : INDEX_NONE;
+}
+
+void UOVRLipSyncFrameSequence::BuildSummaries(const FOVRLipSyncFrameData &Frames,
+											   TArray<FOVRLipSyncFrameSummary> &OutSummaries)
+{
+	OutSummaries.SetNumUninitialized(Frames.Num());
+	for (int32 Frame = 0; Frame < Frames.Num(); ++Frame)
+	{
+		OutSummaries[Frame] =
+			FOVRLipSyncFrameSummary::FromFrame(Frames.GetVisemes(Frame).GetData(), Frames.GetLaughterScore(Frame));
+	}
+}
+
+void FOVRLipSyncFrameLevel::GetFrame(int32 Idx, float *OutVisemes, float &OutLaughterScore) const
+{
+	const auto *FrameVisemes = &Visemes[Idx * FOVRLipSyncFrameData::VisemeCount];
+	for (int32 Viseme = 0; Viseme < FOVRLipSyncFrameData::VisemeCount; ++Viseme)
+	{
+		OutVisemes[Viseme] = FrameVisemes[Viseme] / 255.0f;
+	}
+	OutLaughterScore = LaughterScores[Idx] / 255.0f;
+}
+
+void UOVRLipSyncFrameSequence::BuildDecimatedLevels()
+{
+	Levels.Reset();
+	for (int32 LevelIdx = 0; LevelIdx < NumDecimatedLevels; ++LevelIdx)
+	{
+		// Every level averages blocks of full rate frames, so errors don't accumulate across levels
+		const auto Factor = 2 << LevelIdx;
+		const auto NumLevelFrames = FMath::DivideAndRoundUp(Frames.Num(), Factor);
+		if (NumLevelFrames < 2)
+		{
+			break;
+		}
+		FOVRLipSyncFrameData Averaged;
+		Frames.Decimate(Factor, Averaged);
+		auto &Level = Levels.AddDefaulted_GetRef();
+		Level.FrameRate = FrameRate / Factor;
+		Level.Visemes.SetNumUninitialized(Averaged.Visemes.Num());
+		Level.LaughterScores.SetNumUninitialized(Averaged.Num());
+		for (int32 Idx = 0; Idx < Averaged.Visemes.Num(); ++Idx)
+		{
+			Level.Visemes[Idx] = Quantize(Averaged.Visemes[Idx]);
+		}
+		for (int32 Idx = 0; Idx < Averaged.Num(); ++Idx)
+		{
+			Level.LaughterScores[Idx] = Quantize(Averaged.LaughterScores[Idx]);
+		}
+	}
+}
+
+void UOVRLipSyncFrameSequence::BuildSpeechIndex()
+{
+	BuildSummaries(Frames, Summaries);
+	SpeechIndex.Build(Summaries, FrameRate);
+}
+
+bool UOVRLipSyncFrameSequence::IsSpeakingAt(float Seconds) const
+{
+	return SpeechIndex.FindSegment(TimeToFrame(Seconds)) != INDEX_NONE;
+}
+
+float UOVRLipSyncFrameSequence::GetNextSpeechOnset(float Seconds) const
+{
+	const auto Idx = SpeechIndex.FindNextSegment(FMath::CeilToInt(Seconds * FrameRate));
+	return Idx != INDEX_NONE ? SpeechIndex.SegmentStarts[Idx] / FrameRate : -1.0f;
+}
+
+float UOVRLipSyncFrameSequence::GetSpeechEnergyAt(float Seconds) const { return GetSummaryAt(Seconds).GetEnergy(); }
+
+float UOVRLipSyncFrameSequence::GetMouthOpenAt(float Seconds) const { return GetSummaryAt(Seconds).GetMouthOpen(); }
+
+FOVRLipSyncFrameSummary UOVRLipSyncFrameSequence::GetSummaryAt(float Seconds) const
+{
+	const auto Frame = TimeToFrame(Seconds);
+	return Summaries.IsValidIndex(Frame) ? Summaries[Frame] : FOVRLipSyncFrameSummary();
+}
+
+FOVRLipSyncVisemeValues UOVRLipSyncFrameSequence::GetVisemeValuesAt(float Seconds) const
+{
+	const auto Frame = TimeToFrame(Seconds);
+	if (Frame < 0 || Frame >= Frames.Num())
+	{
+		return FOVRLipSyncVisemeValues();
+	}
+	return FOVRLipSyncVisemeValues::FromFrame(Frames.GetVisemes(Frame).GetData(), Frames.GetLaughterScore(Frame));
+}
+
+void UOVRLipSyncFrameSequence::Add(const TArray<float> &Visemes, float LaughterScore)
+{
+	if (Visemes.Num() == FOVRLipSyncFrameData::VisemeCount)
+	{
+		Frames.Add(Visemes.GetData(), LaughterScore);
+		return;
+	}
+	UE_LOG(LogOvrLipSync, Warning, TEXT("Adding frame with %d visemes to %s, expected %d"), Visemes.Num(), *GetName(),
+		   FOVRLipSyncFrameData::VisemeCount);
+	float FrameVisemes[FOVRLipSyncFrameData::VisemeCount] = {};
+	FMemory::Memcpy(FrameVisemes, Visemes.GetData(),
+					FMath::Min(Visemes.Num(), FOVRLipSyncFrameData::VisemeCount) * sizeof(float));
+	Frames.Add(FrameVisemes, LaughterScore);
+}
+
+bool UOVRLipSyncFrameSequence::Append(const UOVRLipSyncFrameSequence *Other, float CrossfadeSeconds)
+{
+	if (!AppendFrames(Other, CrossfadeSeconds))
+	{
+		return false;
+	}
+	BuildSpeechIndex();
+	if (Levels.Num() > 0)
+	{
+		BuildDecimatedLevels();
+	}
+	return true;
+}
+
+bool UOVRLipSyncFrameSequence::AppendFrames(const UOVRLipSyncFrameSequence *Other, float CrossfadeSeconds)
+{
+	if (!Other)
+	{
+		return false;
+	}
+	if (!FMath::IsNearlyEqual(FrameRate, Other->FrameRate))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't append %s to %s: frame rates differ (%f vs %f)"), *Other->GetName(),
+			   *GetName(), Other->FrameRate, FrameRate);
+		return false;
+	}
+	Frames.Append(Other->Frames, FMath::RoundToInt(CrossfadeSeconds * FrameRate));
+	return true;
+}
+
+UOVRLipSyncFrameSequence *UOVRLipSyncFrameSequence::Concatenate(const TArray<UOVRLipSyncFrameSequence *> &Sequences,
+																  float CrossfadeSeconds)
+{
+	auto Result = NewObject<UOVRLipSyncFrameSequence>(GetTransientPackage());
+	int32 TotalFrames = 0;
+	for (auto Sequence : Sequences)
+	{
+		if (Sequence && Sequence->Num() > 0)
+		{
+			// Result takes the frame rate of the first non-empty sequence
+			if (TotalFrames == 0)
+			{
+				Result->FrameRate = Sequence->FrameRate;
+			}
+			TotalFrames += Sequence->Num();
+		}
+	}
+	// Allocate once, so individual appends never reallocate
+	Result->Frames.Reserve(TotalFrames);
+	for (auto Sequence : Sequences)
+	{
+		if (Sequence && Sequence->Num() > 0 && !Result->AppendFrames(Sequence, CrossfadeSeconds))
+		{
+			return nullptr;
+		}
+	}
+	Result->BuildSpeechIndex();
+	return Result;
+}
+
+void UOVRLipSyncFrameSequence::Serialize(FArchive &Ar)
+{
+#if WITH_EDITOR
+	if (Ar.IsSaving() && Ar.IsCooking() && Ar.CookingTarget())
+	{
+		const auto &CookSettings = UOVRLipSyncSettings::GetCookSettings(Ar.CookingTarget()->IniPlatformName());
+		if (!CookSettings.IsLossless() && Frames.Num() > 0)
+		{
+			// The editor object keeps its source frames, they are swapped out only while the cooked package is written
+			auto SourceFrames = MoveTemp(Frames);
+			auto SourceSummaries = MoveTemp(Summaries);
+			auto SourceSpeechIndex = MoveTemp(SpeechIndex);
+			const auto SourceFrameRate = FrameRate;
+
+			const auto Factor = 1 << CookSettings.FrameRateReduction;
+			FOVRLipSyncFrameData CookedFrames;
+			SourceFrames.Decimate(Factor, CookedFrames);
+			EncodedFrames.Encode(CookedFrames, CookSettings.Encoding, CookSettings.bStripLaughter,
+								 CookSettings.KeyframeTolerance);
+			// Summaries and index describe decoded frames, so loading doesn't have to rebuild them
+			EncodedFrames.Decode(CookedFrames);
+			FrameRate = SourceFrameRate / Factor;
+			BuildSummaries(CookedFrames, Summaries);
+			SpeechIndex.Build(Summaries, FrameRate);
+
+			Super::Serialize(Ar);
+
+			Frames = MoveTemp(SourceFrames);
+			Summaries = MoveTemp(SourceSummaries);
+			SpeechIndex = MoveTemp(SourceSpeechIndex);
+			FrameRate = SourceFrameRate;
+			EncodedFrames = FOVRLipSyncEncodedFrames();
+			return;
+		}
+	}
+#endif
+	Super::Serialize(Ar);
+}
+
+void UOVRLipSyncFrameSequence::PostLoad()
+{
+	Super::PostLoad();
+
+	if (!EncodedFrames.IsEmpty())
+	{
+		EncodedFrames.Decode(Frames);
+		EncodedFrames = FOVRLipSyncEncodedFrames();
+	}
+
+	if (FrameSequence.Num() > 0 && Frames.Num() == 0)
+	{
+		Frames.Reserve(FrameSequence.Num());
+		for (const auto &Frame : FrameSequence)
+		{
+			float FrameVisemes[FOVRLipSyncFrameData::VisemeCount] = {};
+			FMemory::Memcpy(FrameVisemes, Frame.VisemeScores.GetData(),
+							FMath::Min(Frame.VisemeScores.Num(), FOVRLipSyncFrameData::VisemeCount) * sizeof(float));
+			Frames.Add(FrameVisemes, Frame.LaughterScore);
+		}
+		FrameSequence.Empty();
+	}
+	// Sequences saved before the index was introduced
+	if (Summaries.Num() != Frames.Num())
+	{
+		BuildSpeechIndex();
+	}
+}
+
+void UOVRLipSyncFrameSequence::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Levels are derived data, only cooked packages carry them
+	if (SaveContext.IsCooking())
+	{
+		BuildDecimatedLevels();
+	}
+	else
+	{
+		Levels.Empty();
+	}
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerator.cpp
+ * Content     :   OVRLipSync sequence generation engine
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncGenerator.h"
+
+#include "Misc/Paths.h"
+#include "OVRLipSyncModule.h"
+#include "OVRLipSyncSettings.h"
+
+static_assert(FOVRLipSyncFrameData::VisemeCount == OVRLipSyncVisemeCount, "Unexpected number of visemes");
+
+FOVRLipSyncGenerator::FOVRLipSyncGenerator(const FOVRLipSyncGenerationSettings &InSettings) : Settings(InSettings)
+{
+#if WITH_OVRLIPSYNC_SDK
+	Analyzer = MakeUnique<FOVRLipSyncContextAnalyzer>(Settings.Provider, Settings.SampleRate, Settings.BufferSize,
+													  Settings.ModelPath, Settings.bEnableAcceleration);
+#else
+	Analyzer = MakeUnique<FOVRLipSyncEnergyAnalyzer>();
+#endif
+	FOVRLipSyncAnalysisSettings AnalysisSettings;
+	AnalysisSettings.SampleRate = Settings.SampleRate;
+	AnalysisSettings.NumChannels = Settings.NumChannels;
+	AnalysisSettings.HopMs = Settings.HopMs;
+	AnalysisSettings.WindowMs = Settings.WindowMs;
+	Analysis = MakeUnique<FOVRLipSyncChunkedAnalysis>(*Analyzer, AnalysisSettings);
+}
+
+FOVRLipSyncGenerator::~FOVRLipSyncGenerator() = default;
+
+int32 FOVRLipSyncGenerator::GetNumFrames(int32 NumSamples) const { return Analysis->GetNumFrames(NumSamples); }
+
+float FOVRLipSyncGenerator::GetFrameRate() const { return Analysis->GetFrameRate(); }
+
+bool FOVRLipSyncGenerator::Generate(const int16 *PCMData, int32 NumSamples, FOVRLipSyncFrameData &OutFrames)
+{
+	return Generate(PCMData, NumSamples, OutFrames, [](float) { return true; });
+}
+
+bool FOVRLipSyncGenerator::Generate(const int16 *PCMData, int32 NumSamples, FOVRLipSyncFrameData &OutFrames,
+									FProgressCallback Progress)
+{
+	return Analysis->Generate(PCMData, NumSamples, OutFrames.Visemes, OutFrames.LaughterScores, Progress);
+}
+
+FString FOVRLipSyncGenerator::GetOfflineModelPath()
+{
+	auto ModelPath = FPaths::Combine(UOVRLipSyncSettings::GetPluginDir(), TEXT("OfflineModel"),
+									 TEXT("ovrlipsync_offline_model.pb"));
+	if (!FPaths::FileExists(ModelPath))
+	{
+		UE_LOG(LogOvrLipSync, Warning, TEXT("Offline model not found at: %s"), *ModelPath);
+		return FString();
+	}
+	return ModelPath;
+}
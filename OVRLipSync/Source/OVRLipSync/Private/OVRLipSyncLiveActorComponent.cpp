@@ -25,19 +25,19 @@
 
 #include "AndroidPermissionCallbackProxy.h"
 #include "AndroidPermissionFunctionLibrary.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeLock.h"
+#include "OVRLipSyncCaptureService.h"
 #include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncModule.h"
+#include "OVRLipSyncRemoteContext.h"
 #include "VoiceModule.h"
 #include "TimerManager.h"
+#include "UObject/Package.h"
 
 #include <Core.h>
 #include <algorithm>
 
-// This isn't being used anymore in StartVoiceCapture()
-//
-
-#define DEFAULT_DEVICE_NAME TEXT("")
-
-
 // Convert OVRLipSyncProviderKind enum to OVRLipSync
 ovrLipSyncContextProvider ContextProviderFromProviderKind(OVRLipSyncProviderKind Kind)
 {
@@ -58,29 +58,160 @@ void UOVRLipSyncActorComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	LipSyncContext = MakeShared<UOVRLipSyncContextWrapper>(ContextProviderFromProviderKind(ProviderKind), SampleRate,
-														   BufferSize, FString(), EnableHardwareAcceleration);
-	LipSyncContext->SetAsyncCallback([this](const TArray<float> &NewVisemes, float NewLaughterScore) {
+	CreateContext(SampleRate);
+}
+
+void UOVRLipSyncActorComponent::CreateContext(int32 InSampleRate)
+{
+	FScopeLock Lock(&ContextLock);
+	RemoteContext = nullptr;
+	LipSyncContext = nullptr;
+	ContextSampleRate = InSampleRate;
+	if (bAnalyzeOutOfProcess)
+	{
+		RemoteContext = MakeUnique<FOVRLipSyncRemoteContext>(
+			ContextProviderFromProviderKind(ProviderKind), InSampleRate,
+			[this](const TArray<float> &NewVisemes, float NewLaughterScore, double SubmitTime) {
+				OnPrediction(NewVisemes, NewLaughterScore, SubmitTime);
+			});
+		if (RemoteContext->Start())
+		{
+			return;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("Can't start LipSync helper process, analysing in process."));
+		RemoteContext = nullptr;
+	}
+	CreateLocalContext(InSampleRate);
+}
+
+void UOVRLipSyncActorComponent::EnsureContext(int32 InSampleRate)
+{
+	if (!HasContext() || ContextSampleRate != InSampleRate)
+	{
+		CreateContext(InSampleRate);
+	}
+}
+
+void UOVRLipSyncActorComponent::CreateLocalContext(int32 InSampleRate)
+{
+	LipSyncContext = MakeShared<UOVRLipSyncContextWrapper>(ContextProviderFromProviderKind(ProviderKind),
+														   InSampleRate, BufferSize, FString(),
+														   EnableHardwareAcceleration);
+	LipSyncContext->SetAsyncCallback(
+		[this](const TArray<float> &NewVisemes, float NewLaughterScore, double SubmitTime) {
+			OnPrediction(NewVisemes, NewLaughterScore, SubmitTime);
+		});
+}
+
+void UOVRLipSyncActorComponent::OnPrediction(const TArray<float> &NewVisemes, float NewLaughterScore,
+											 double SubmitTime)
+{
+	CSV_SCOPED_TIMING_STAT(OVRLipSync, LiveResult);
+	const auto StartTime = FPlatformTime::Seconds();
+	{
+		FScopeLock Lock(&PredictionLock);
 		Visemes = NewVisemes;
 		LaughterScore = NewLaughterScore;
-		OnVisemesReady.Broadcast();
-	});
+		if (NewVisemes.Num() == FOVRLipSyncFrameData::VisemeCount)
+		{
+			Summary = FOVRLipSyncFrameSummary::FromFrame(NewVisemes.GetData(), NewLaughterScore);
+		}
+	}
+	if (bRecording)
+	{
+		RecordFrame(NewVisemes, NewLaughterScore);
+	}
+	BroadcastVisemes();
+
+	FScopeLock Lock(&LatencyLock);
+	if (SubmitTime > 0.0)
+	{
+		LatencyStats.Add(static_cast<float>((StartTime - SubmitTime) * 1000.0));
+	}
+	CallbackStats.Add(static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0));
+}
+
+void UOVRLipSyncActorComponent::AnalyzeAudio(const int16 *AudioData, int32 NumSamples, bool bStereo)
+{
+	FScopeLock Lock(&ContextLock);
+	FallBackIfHelperFailed();
+	if (RemoteContext)
+	{
+		RemoteContext->ProcessFrameAsync(AudioData, NumSamples, bStereo);
+	}
+	else if (LipSyncContext)
+	{
+		LipSyncContext->ProcessFrameAsync(AudioData, NumSamples, bStereo);
+	}
+}
+
+void UOVRLipSyncActorComponent::AnalyzeAudio(const float *AudioData, int32 NumSamples, bool bStereo)
+{
+	FScopeLock Lock(&ContextLock);
+	FallBackIfHelperFailed();
+	if (RemoteContext)
+	{
+		RemoteContext->ProcessFrameAsync(AudioData, NumSamples, bStereo);
+	}
+	else if (LipSyncContext)
+	{
+		LipSyncContext->ProcessFrameAsync(AudioData, NumSamples, bStereo);
+	}
+}
+
+void UOVRLipSyncActorComponent::FallBackIfHelperFailed()
+{
+	if (!RemoteContext || !RemoteContext->HasFailed())
+	{
+		return;
+	}
+	UE_LOG(LogTemp, Warning, TEXT("LipSync helper process failed for good, analysing in process."));
+	RemoteContext = nullptr;
+	CreateLocalContext(ContextSampleRate);
+}
+
+bool UOVRLipSyncActorComponent::IsAnalyzingOutOfProcess() const
+{
+	FScopeLock Lock(&ContextLock);
+	return RemoteContext.IsValid();
+}
+
+FOVRLipSyncLatencyStats UOVRLipSyncActorComponent::GetLatencyStats() const
+{
+	FScopeLock Lock(&LatencyLock);
+	return LatencyStats;
+}
+
+FOVRLipSyncLatencyStats UOVRLipSyncActorComponent::GetCallbackStats() const
+{
+	FScopeLock Lock(&LatencyLock);
+	return CallbackStats;
 }
 
 void UOVRLipSyncActorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	StopRecordingWriters();
 	Stop();
-	LipSyncContext = nullptr;
+	{
+		FScopeLock Lock(&ContextLock);
+		LipSyncContext = nullptr;
+		RemoteContext = nullptr;
+	}
 
 	Super::EndPlay(EndPlayReason);
 }
 
 void UOVRLipSyncActorComponent::Start()
 {
-	if (VoiceCapture)
+	if (VoiceCapture || AudioCapture || SharedCaptureHandle.IsValid())
 	{
 		Stop();
 	}
+	{
+		FScopeLock Lock(&LatencyLock);
+		LatencyStats = FOVRLipSyncLatencyStats();
+		CallbackStats = FOVRLipSyncLatencyStats();
+	}
 
 #if PLATFORM_ANDROID
 	FString AudioPermission = TEXT("android.permission.RECORD_AUDIO");
@@ -98,10 +229,10 @@ void UOVRLipSyncActorComponent::Start()
 	}
 	else
 	{
-		StartVoiceCapture();
+		StartCapture();
 	}
 #else
-	StartVoiceCapture();
+	StartCapture();
 #endif
 }
 
@@ -112,7 +243,7 @@ void UOVRLipSyncActorComponent::PermissionCallback(const TArray<FString> &Permis
 	if (GrantResults.Num() > 0 && GrantResults[0])
 	{
 		UE_LOG(LogTemp, Log, TEXT("Audio permissions granted."));
-		StartVoiceCapture();
+		StartCapture();
 	}
 	else
 	{
@@ -120,9 +251,39 @@ void UOVRLipSyncActorComponent::PermissionCallback(const TArray<FString> &Permis
 	}
 }
 
+void UOVRLipSyncActorComponent::StartCapture()
+{
+	switch (CaptureBackend)
+	{
+	default:
+	case OVRLipSyncCaptureBackend::VoiceCapture:
+		StartVoiceCapture();
+		break;
+	case OVRLipSyncCaptureBackend::AudioCapture:
+		StartAudioCapture();
+		break;
+	case OVRLipSyncCaptureBackend::SharedDevice:
+		StartSharedCapture();
+		break;
+	}
+}
+
 void UOVRLipSyncActorComponent::StartVoiceCapture()
 {
-	VoiceCapture = FVoiceModule::Get().CreateVoiceCapture("", SampleRate, 1);
+	// An audio capture device may have left a context at its own rate
+	EnsureContext(SampleRate);
+	if (VoiceCaptureOverride)
+	{
+		VoiceCapture = VoiceCaptureOverride;
+		if (!VoiceCapture->Init(DefaultDeviceName, SampleRate, 1))
+		{
+			VoiceCapture = nullptr;
+		}
+	}
+	else
+	{
+		VoiceCapture = FVoiceModule::Get().CreateVoiceCapture(DefaultDeviceName, SampleRate, 1);
+	}
 	if (!VoiceCapture)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Can't create voice capture."));
@@ -134,27 +295,141 @@ void UOVRLipSyncActorComponent::StartVoiceCapture()
 	}
 
 	VoiceCapture->Start();
+	if (bPollVoiceCaptureManually)
+	{
+		return;
+	}
 	auto &TimerManager = GetWorld()->GetTimerManager();
 	TimerManager.SetTimer(VoiceCaptureTimer, this, &UOVRLipSyncActorComponent::OnVoiceCaptureTimer,
 						  VoiceCaptureTimerRate, true);
 }
 
+void UOVRLipSyncActorComponent::StartAudioCapture()
+{
+	AudioCapture = MakeUnique<Audio::FAudioCapture>();
+
+	Audio::FAudioCaptureDeviceParams Params;
+	if (!DefaultDeviceName.IsEmpty())
+	{
+		TArray<Audio::FCaptureDeviceInfo> Devices;
+		AudioCapture->GetCaptureDevicesAvailable(Devices);
+		Params.DeviceIndex = Devices.IndexOfByPredicate(
+			[this](const Audio::FCaptureDeviceInfo &Device) { return Device.DeviceName == DefaultDeviceName; });
+		if (Params.DeviceIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Capture device %s not found, using default device."), *DefaultDeviceName);
+		}
+	}
+
+	// The device delivers audio at its own rate, so the context has to run at that rate
+	Audio::FCaptureDeviceInfo DeviceInfo;
+	auto CaptureSampleRate = SampleRate;
+	if (AudioCapture->GetCaptureDeviceInfo(DeviceInfo, Params.DeviceIndex) && DeviceInfo.PreferredSampleRate > 0)
+	{
+		CaptureSampleRate = DeviceInfo.PreferredSampleRate;
+	}
+	EnsureContext(CaptureSampleRate);
+
+	// Ask for 10ms callbacks, the same cadence the voice capture timer polls at
+	const auto NumFramesDesired = static_cast<uint32>(FMath::Max(1, CaptureSampleRate / 100));
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+	auto OnCapture = [this](const float *AudioData, int32 NumFrames, int32 NumChannels, int32, double, bool) {
+		OnAudioCapture(AudioData, NumFrames, NumChannels);
+	};
+	auto bOpened = AudioCapture->OpenCaptureStream(Params, MoveTemp(OnCapture), NumFramesDesired);
+#else
+	auto OnCapture = [this](const void *AudioData, int32 NumFrames, int32 NumChannels, int32, double, bool) {
+		OnAudioCapture(static_cast<const float *>(AudioData), NumFrames, NumChannels);
+	};
+	auto bOpened = AudioCapture->OpenAudioCaptureStream(Params, MoveTemp(OnCapture), NumFramesDesired);
+#endif
+	if (!bOpened || !AudioCapture->StartStream())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't start audio capture."));
+		AudioCapture->CloseStream();
+		AudioCapture = nullptr;
+		return;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Started audio capture at %d Hz."), CaptureSampleRate);
+}
+
+void UOVRLipSyncActorComponent::StartSharedCapture()
+{
+	EnsureContext(SampleRate);
+	SharedCaptureHandle = FOVRLipSyncCaptureService::Get().Subscribe(
+		DefaultDeviceName, SampleRate, [this](const int16 *Samples, int32 NumSamples) {
+			AnalyzeAudio(Samples, NumSamples);
+		});
+	if (!SharedCaptureHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't subscribe to capture device %s."), *DefaultDeviceName);
+	}
+}
+
+// Called on the capture device thread whenever a new buffer of float samples is available
+void UOVRLipSyncActorComponent::OnAudioCapture(const float *AudioData, int32 NumFrames, int32 NumChannels)
+{
+	CSV_SCOPED_TIMING_STAT(OVRLipSync, LiveAudioCapture);
+
+	if (!HasContext() || NumFrames <= 0 || NumChannels <= 0)
+	{
+		return;
+	}
+	if (NumChannels <= 2)
+	{
+		AnalyzeAudio(AudioData, NumFrames, NumChannels == 2);
+		return;
+	}
+
+	AudioCaptureBuffer.SetNumUninitialized(NumFrames);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		float Sum = 0.0f;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Sum += AudioData[Frame * NumChannels + Channel];
+		}
+		AudioCaptureBuffer[Frame] = Sum / NumChannels;
+	}
+	AnalyzeAudio(AudioCaptureBuffer.GetData(), NumFrames);
+}
+
 void UOVRLipSyncActorComponent::FeedAudio(const TArray<uint8> &VoiceData)
 {
-	if (!LipSyncContext)
+	if (!HasContext())
 	{
 		return;
 	}
 
 	auto *ShortData = reinterpret_cast<const int16 *>(VoiceData.GetData());
 	auto ShortDataSize = VoiceData.Num() / 2;
-	LipSyncContext->ProcessFrameAsync(ShortData, ShortDataSize);
+	AnalyzeAudio(ShortData, ShortDataSize);
 }
 
 void UOVRLipSyncActorComponent::Stop()
 {
 	InitNeutralPose();
-	
+
+	const auto Latency = GetLatencyStats();
+	if (Latency.NumFrames > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LipSync %s analysis latency: average %.2f ms, max %.2f ms over %llu frames."),
+			   IsAnalyzingOutOfProcess() ? TEXT("out-of-process") : TEXT("in-process"), Latency.AverageMs, Latency.MaxMs,
+			   Latency.NumFrames);
+	}
+
+	if (AudioCapture)
+	{
+		// Closing the stream waits for the capture callback, so the context can't be used after this
+		AudioCapture->StopStream();
+		AudioCapture->CloseStream();
+		AudioCapture = nullptr;
+	}
+
+	// Unsubscribing waits for the device thread to finish delivering audio to this component
+	FOVRLipSyncCaptureService::Get().Unsubscribe(SharedCaptureHandle);
+	SharedCaptureHandle.Reset();
+
 	if (!VoiceCapture)
 	{
 		return;
@@ -167,9 +442,23 @@ void UOVRLipSyncActorComponent::Stop()
 
 }
 
+void UOVRLipSyncActorComponent::SetVoiceCaptureOverride(TSharedPtr<IVoiceCapture> InVoiceCaptureOverride)
+{
+	VoiceCaptureOverride = InVoiceCaptureOverride;
+}
+
+void UOVRLipSyncActorComponent::SetPollVoiceCaptureManually(bool bInPollManually)
+{
+	bPollVoiceCaptureManually = bInPollManually;
+}
+
+void UOVRLipSyncActorComponent::PollVoiceCapture() { OnVoiceCaptureTimer(); }
+
 // Called every VoiceCaptureTimerRate seconds (10ms) to process audio data
 void UOVRLipSyncActorComponent::OnVoiceCaptureTimer()
 {
+	CSV_SCOPED_TIMING_STAT(OVRLipSync, LiveCapturePoll);
+
 	if (!VoiceCapture || !VoiceCapture.IsValid())
 	{
 		return;
@@ -183,7 +472,7 @@ void UOVRLipSyncActorComponent::OnVoiceCaptureTimer()
 	}
 	if (CaptureState == EVoiceCaptureState::UnInitialized)
 	{
-		if (!VoiceCapture->Init("", SampleRate, 1) || !VoiceCapture->Start())
+		if (!VoiceCapture->Init(DefaultDeviceName, SampleRate, 1) || !VoiceCapture->Start())
 		{
 			UE_LOG(LogTemp, Log, TEXT("Unsuccessfully tried to restart VoiceCapture."));
 			return;
@@ -216,4 +505,114 @@ void UOVRLipSyncActorComponent::OnVoiceCaptureTimer()
 	FeedAudio(VoiceData);
 }
 
+void UOVRLipSyncActorComponent::StartRecording(float MaxDurationSeconds)
+{
+	// Predictions arrive once per fed buffer, which is never shorter than 5ms in practice
+	constexpr float MaxFramesPerSecond = 200.0f;
+
+	// A recording in progress is restarted, its writers must be done before the buffer can be reallocated
+	StopRecordingWriters();
+	const auto Capacity = FMath::Max(1, FMath::CeilToInt(MaxDurationSeconds * MaxFramesPerSecond));
+	// The buffer is kept between recordings unless StopRecording handed it over
+	if (RecordedFrames.Num() < Capacity)
+	{
+		RecordedFrames.SetNumUninitialized(Capacity);
+	}
+	NumClaimedFrames = 0;
+	NumRecordedFrames = 0;
+	NumDroppedFrames = 0;
+	RecordingStartTime = FPlatformTime::Seconds();
+	bRecording = true;
+}
+
+bool UOVRLipSyncActorComponent::IsRecording() const { return bRecording; }
+
+void UOVRLipSyncActorComponent::StopRecordingWriters()
+{
+	bRecording = false;
+	// Writers register before checking bRecording, so any writer missing from the count sees it off. Each
+	// only copies a single frame, spinning is cheaper than a wake up.
+	while (NumRecordingWriters.Load() > 0)
+	{
+		FPlatformProcess::Yield();
+	}
+}
+
+void UOVRLipSyncActorComponent::RecordFrame(const TArray<float> &NewVisemes, float NewLaughterScore)
+{
+	++NumRecordingWriters;
+	if (!bRecording)
+	{
+		--NumRecordingWriters;
+		return;
+	}
+	const int32 Idx = NumClaimedFrames++;
+	if (Idx >= RecordedFrames.Num())
+	{
+		++NumDroppedFrames;
+		--NumRecordingWriters;
+		return;
+	}
+	auto &Frame = RecordedFrames[Idx];
+	Frame.Time = FPlatformTime::Seconds() - RecordingStartTime;
+	FMemory::Memzero(Frame.Visemes);
+	FMemory::Memcpy(Frame.Visemes, NewVisemes.GetData(),
+					FMath::Min(NewVisemes.Num(), FOVRLipSyncFrameData::VisemeCount) * sizeof(float));
+	Frame.LaughterScore = NewLaughterScore;
+	// Sequentially consistent, so the slot contents are visible to whoever reads the count
+	++NumRecordedFrames;
+	--NumRecordingWriters;
+}
+
+UOVRLipSyncFrameSequence *UOVRLipSyncActorComponent::StopRecording(float FrameRate)
+{
+	if (!bRecording)
+	{
+		return nullptr;
+	}
+	StopRecordingWriters();
+	const auto Duration = FPlatformTime::Seconds() - RecordingStartTime;
+	if (NumDroppedFrames.Load() > 0)
+	{
+		UE_LOG(LogOvrLipSync, Warning, TEXT("Recording buffer overflowed, %d predictions were dropped"),
+			   NumDroppedFrames.Load());
+	}
+	// Writers are done, every claimed slot within the buffer is published
+	auto Frames = MoveTemp(RecordedFrames);
+	Frames.SetNum(NumRecordedFrames.Load());
+	const int32 NumFrames = Frames.Num();
+
+	auto Sequence = NewObject<UOVRLipSyncFrameSequence>(GetTransientPackage());
+	Sequence->FrameRate = FrameRate;
+	if (NumFrames == 0 || FrameRate <= 0.0f)
+	{
+		return Sequence;
+	}
+
+	// Predictions arrive at whatever rate audio is fed, interpolate them to the fixed sequence rate
+	const auto NumOutFrames = FMath::Max(1, FMath::FloorToInt(Duration * FrameRate));
+	Sequence->Frames.Reserve(NumOutFrames);
+	int32 Next = 0;
+	float OutVisemes[FOVRLipSyncFrameData::VisemeCount];
+	for (int32 OutFrame = 0; OutFrame < NumOutFrames; ++OutFrame)
+	{
+		const auto Time = OutFrame / static_cast<double>(FrameRate);
+		while (Next < NumFrames && Frames[Next].Time <= Time)
+		{
+			++Next;
+		}
+		const auto &After = Frames[FMath::Min(Next, NumFrames - 1)];
+		const auto &Before = Frames[FMath::Max(Next - 1, 0)];
+		const auto Span = After.Time - Before.Time;
+		const auto Alpha = Span > 0.0 ? static_cast<float>(FMath::Clamp((Time - Before.Time) / Span, 0.0, 1.0)) : 0.0f;
+		for (int32 Viseme = 0; Viseme < FOVRLipSyncFrameData::VisemeCount; ++Viseme)
+		{
+			OutVisemes[Viseme] = FMath::Lerp(Before.Visemes[Viseme], After.Visemes[Viseme], Alpha);
+		}
+		Sequence->Frames.Add(OutVisemes, FMath::Lerp(Before.LaughterScore, After.LaughterScore, Alpha));
+	}
+	Sequence->BuildSpeechIndex();
+	return Sequence;
+}
+
 const float UOVRLipSyncActorComponent::VoiceCaptureTimerRate = .01f;
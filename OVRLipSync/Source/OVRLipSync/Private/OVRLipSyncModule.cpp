@@ -24,13 +24,29 @@
 
 #include "Modules/ModuleManager.h"
 #include "OVRLipSync.h"
+#include "OVRLipSyncCaptureService.h"
+#include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncSettings.h"
 
 DEFINE_LOG_CATEGORY(LogOvrLipSync);
+CSV_DEFINE_CATEGORY_MODULE(OVRLIPSYNC_API, OVRLipSync, true);
 
 class FOVRLipSyncModule : public IModuleInterface
 {
 public:
-	void ShutdownModule() override { ovrLipSync_Shutdown(); }
+	void StartupModule() override
+	{
+		// In-process contexts load the SDK from the plugin, wherever it is installed
+		UOVRLipSyncContextWrapper::SetLibraryDirectory(UOVRLipSyncSettings::GetLibraryDir());
+	}
+
+	void ShutdownModule() override
+	{
+		FOVRLipSyncCaptureService::Get().Shutdown();
+#if WITH_OVRLIPSYNC_SDK
+		ovrLipSync_Shutdown();
+#endif
+	}
 };
 
 IMPLEMENT_MODULE(FOVRLipSyncModule, OVRLipSync);
@@ -23,5 +23,8 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 OVRLIPSYNC_API DECLARE_LOG_CATEGORY_EXTERN(LogOvrLipSync, Log, All);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(OVRLIPSYNC_API, OVRLipSync);
@@ -24,6 +24,7 @@
 #include "OVRLipSyncPlaybackActorComponent.h"
 #include "Sound/SoundWave.h"
 #include "GameFramework/Actor.h"
+#include "OVRLipSyncModule.h"
 
 UAudioComponent *UOVRLipSyncPlaybackActorComponent::FindAutoplayAudioComponent() const
 {
@@ -46,7 +47,7 @@ UAudioComponent *UOVRLipSyncPlaybackActorComponent::FindAutoplayAudioComponent()
 void UOVRLipSyncPlaybackActorComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	if (!Sequence)
+	if (!Sequence && !BankLine.IsValid())
 	{
 		return;
 	}
@@ -67,22 +68,62 @@ void UOVRLipSyncPlaybackActorComponent::EndPlay(const EEndPlayReason::Type EndPl
 void UOVRLipSyncPlaybackActorComponent::OnAudioPlaybackPercent(const UAudioComponent *, const USoundWave *SoundWave,
 															   float Percent)
 {
-	if (!Sequence)
+	SetPlaybackTime(SoundWave->Duration * Percent);
+}
+
+void UOVRLipSyncPlaybackActorComponent::SetPlaybackTime(float PlayPos)
+{
+	CSV_SCOPED_TIMING_STAT(OVRLipSync, PlaybackUpdate);
+
+	// Sequence view is taken on every update, as sequence could be appended to while being played
+	const auto View = BankLine.IsValid() ? BankLine : Sequence ? Sequence->GetView() : FOVRLipSyncSequenceView();
+	if (!View.IsValid())
 	{
 		InitNeutralPose();
 		return;
 	}
-	auto PlayPos = SoundWave->Duration * Percent;
-	auto IntPos = static_cast<unsigned>(PlayPos * 100);
-	if (IntPos >= Sequence->Num())
+	auto IntPos = static_cast<int32>(PlayPos * View.FrameRate);
+	if (IntPos < 0 || IntPos >= View.NumFrames)
 	{
 		InitNeutralPose();
 		return;
 	}
-	const auto &Frame = (*Sequence)[IntPos];
-	LaughterScore = Frame.LaughterScore;
-	Visemes = Frame.VisemeScores;
-	OnVisemesReady.Broadcast();
+	Summary = View.GetSummary(IntPos);
+	const auto LevelIdx = SelectLevel();
+	if (!bSummaryOnly && LevelIdx != INDEX_NONE)
+	{
+		const auto &Level = Sequence->Levels[LevelIdx];
+		const auto LevelPos = FMath::Clamp(static_cast<int32>(PlayPos * Level.FrameRate), 0, Level.Num() - 1);
+		Visemes.SetNumUninitialized(FOVRLipSyncFrameData::VisemeCount);
+		Level.GetFrame(LevelPos, Visemes.GetData(), LaughterScore);
+	}
+	else if (!bSummaryOnly)
+	{
+		const auto FrameVisemes = View.GetVisemes(IntPos);
+		LaughterScore = View.GetLaughterScore(IntPos);
+		Visemes.Reset();
+		Visemes.Append(FrameVisemes.GetData(), FrameVisemes.Num());
+	}
+	BroadcastVisemes();
+}
+
+int32 UOVRLipSyncPlaybackActorComponent::SelectLevel() const
+{
+	// Bank lines only have full rate frames
+	if (BankLine.IsValid() || !Sequence || Sequence->Levels.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+	int32 LevelIdx = INDEX_NONE;
+	for (auto Threshold : LevelSignificanceThresholds)
+	{
+		if (Significance >= Threshold)
+		{
+			break;
+		}
+		++LevelIdx;
+	}
+	return FMath::Min(LevelIdx, Sequence->Levels.Num() - 1);
 }
 
 void UOVRLipSyncPlaybackActorComponent::OnAudioPlaybackFinished(UAudioComponent *) { InitNeutralPose(); }
@@ -92,7 +133,7 @@ void UOVRLipSyncPlaybackActorComponent::Start(UAudioComponent *InAudioComponent,
 	AudioComponent = InAudioComponent;
 	if (InSequence)
 	{
-		Sequence = InSequence;
+		SetPlaybackSequence(InSequence);
 	}
 	PlaybackPercentHandle = AudioComponent->OnAudioPlaybackPercentNative.AddUObject(
 		this, &UOVRLipSyncPlaybackActorComponent::OnAudioPlaybackPercent);
@@ -116,4 +157,30 @@ void UOVRLipSyncPlaybackActorComponent::Stop()
 void UOVRLipSyncPlaybackActorComponent::SetPlaybackSequence(UOVRLipSyncFrameSequence *InSequence)
 {
 	Sequence = InSequence;
+	Bank = nullptr;
+	BankLine = FOVRLipSyncSequenceView();
+}
+
+bool UOVRLipSyncPlaybackActorComponent::StartFromBank(UAudioComponent *InAudioComponent,
+													  UOVRLipSyncSequenceBank *InBank, const FString &LineId)
+{
+	if (!SetPlaybackBankLine(InBank, LineId))
+	{
+		return false;
+	}
+	Start(InAudioComponent, nullptr);
+	return true;
+}
+
+bool UOVRLipSyncPlaybackActorComponent::SetPlaybackBankLine(UOVRLipSyncSequenceBank *InBank, const FString &LineId)
+{
+	FOVRLipSyncSequenceView View;
+	if (!InBank || !InBank->FindLine(LineId, View))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't find line %s in sequence bank"), *LineId);
+		return false;
+	}
+	Bank = InBank;
+	BankLine = View;
+	return true;
 }
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncRemoteContext.cpp
+ * Content     :   OVRLipSync out-of-process live analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncRemoteContext.h"
+
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "OVRLipSyncModule.h"
+#include "OVRLipSyncRemoteProtocol.h"
+#include "OVRLipSyncSettings.h"
+
+namespace
+{
+// Time the reader thread sleeps when there are no frames to read
+constexpr float PollIntervalSeconds = 0.001f;
+// Time between checks of the helper process
+constexpr double CheckIntervalSeconds = 0.1;
+
+TAtomic<int32> NextContextId{0};
+} // namespace
+
+FOVRLipSyncRemoteContext::FOVRLipSyncRemoteContext(ovrLipSyncContextProvider InProvider, int32 InSampleRate,
+												   FOnFrame InOnFrame)
+	: Provider(InProvider), SampleRate(InSampleRate), OnFrame(MoveTemp(InOnFrame))
+{
+	Name = FString::Printf(TEXT("OVRLipSync_%u_%d"), FPlatformProcess::GetCurrentProcessId(), NextContextId++);
+}
+
+FOVRLipSyncRemoteContext::~FOVRLipSyncRemoteContext()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+	}
+	// Closing the audio ring tells the helper to exit, it is killed if it doesn't
+	AudioRing.Close();
+	FrameRing.Close();
+	StopHelper();
+}
+
+bool FOVRLipSyncRemoteContext::Start()
+{
+	if (!AudioRing.Create(FOVRLipSyncRemoteProtocol::GetAudioRingName(Name),
+						  FOVRLipSyncRemoteProtocol::AudioRingCapacity) ||
+		!FrameRing.Create(FOVRLipSyncRemoteProtocol::GetFrameRingName(Name),
+						  FOVRLipSyncRemoteProtocol::FrameRingCapacity) ||
+		!LaunchHelper())
+	{
+		AudioRing.Close();
+		FrameRing.Close();
+		return false;
+	}
+	LastProgressTime = LastCheckTime = FPlatformTime::Seconds();
+	Thread = FRunnableThread::Create(this, TEXT("OVRLipSyncRemoteContext"), 0, TPri_AboveNormal);
+	return true;
+}
+
+bool FOVRLipSyncRemoteContext::LaunchHelper()
+{
+	const auto Executable = GetDefault<UOVRLipSyncSettings>()->GetHelperExecutablePath();
+	// The helper loads the SDK from the plugin the game uses
+	const auto LibDir = UOVRLipSyncSettings::GetLibraryDir();
+	const auto Params = FString::Printf(TEXT("-Remote=%s -Provider=%d -ParentPID=%u -LibDir=\"%s\""), *Name,
+										static_cast<int32>(Provider), FPlatformProcess::GetCurrentProcessId(),
+										*LibDir);
+	HelperHandle = FPlatformProcess::CreateProc(*Executable, *Params, true, true, true, nullptr, 0, nullptr, nullptr);
+	if (!HelperHandle.IsValid())
+	{
+		UE_LOG(LogOvrLipSync, Warning, TEXT("Can't launch LipSync helper %s"), *Executable);
+		return false;
+	}
+	UE_LOG(LogOvrLipSync, Log, TEXT("Launched LipSync helper for %s"), *Name);
+	bHelperRunning = true;
+	return true;
+}
+
+void FOVRLipSyncRemoteContext::StopHelper()
+{
+	bHelperRunning = false;
+	if (!HelperHandle.IsValid())
+	{
+		return;
+	}
+	if (FPlatformProcess::IsProcRunning(HelperHandle))
+	{
+		FPlatformProcess::TerminateProc(HelperHandle, true);
+		FPlatformProcess::WaitForProc(HelperHandle);
+	}
+	FPlatformProcess::CloseProc(HelperHandle);
+	HelperHandle.Reset();
+}
+
+void FOVRLipSyncRemoteContext::CheckHelper(double Now)
+{
+	if (!bHelperRunning)
+	{
+		return;
+	}
+	// Progress is the helper taking audio, an empty ring is never a stall
+	const auto ReadOffset = AudioRing.GetReadOffset();
+	if (ReadOffset != LastAudioReadOffset || ReadOffset == AudioRing.GetWriteOffset())
+	{
+		LastAudioReadOffset = ReadOffset;
+		LastProgressTime = Now;
+	}
+	const auto bRunning = FPlatformProcess::IsProcRunning(HelperHandle);
+	const auto bStalled = Now - LastProgressTime > GetDefault<UOVRLipSyncSettings>()->HelperStallTimeoutSeconds;
+	if (bRunning && !bStalled)
+	{
+		return;
+	}
+
+	UE_LOG(LogOvrLipSync, Warning, TEXT("LipSync helper for %s %s"), *Name,
+		   bRunning ? TEXT("stalled") : TEXT("exited"));
+	StopHelper();
+	if (NumRestarts >= GetDefault<UOVRLipSyncSettings>()->MaxHelperRestarts)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Giving up on LipSync helper for %s after %d restarts"), *Name,
+			   NumRestarts.Load());
+		bFailed = true;
+		return;
+	}
+	++NumRestarts;
+	// The rings survive the helper, but audio the old one didn't take is up to a stall timeout old, frames
+	// for it would arrive as if they were current. The helper is gone, so this side may drop it.
+	AudioRing.Discard();
+	LastAudioReadOffset = AudioRing.GetReadOffset();
+	if (!LaunchHelper())
+	{
+		bFailed = true;
+		return;
+	}
+	LastProgressTime = Now;
+}
+
+void FOVRLipSyncRemoteContext::ProcessFrameAsync(const int16 *AudioBuffer, int32 NumSamples, bool bStereo)
+{
+	if (!bHelperRunning)
+	{
+		++NumDroppedBuffers;
+		return;
+	}
+	FOVRLipSyncRemoteAudio Audio;
+	Audio.Sequence = NextSequence++;
+	Audio.SubmitTime = FPlatformTime::Seconds();
+	Audio.SampleRate = SampleRate;
+	Audio.NumChannels = bStereo ? 2 : 1;
+	if (!AudioRing.Write(&Audio, sizeof(Audio), AudioBuffer, NumSamples * Audio.NumChannels * sizeof(int16)))
+	{
+		++NumDroppedBuffers;
+	}
+}
+
+void FOVRLipSyncRemoteContext::ProcessFrameAsync(const float *AudioBuffer, int32 NumSamples, bool bStereo)
+{
+	// Converted before writing, which also halves the amount of data going through the ring
+	const auto Count = NumSamples * (bStereo ? 2 : 1);
+	ConvertedAudio.SetNumUninitialized(Count);
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+	{
+		ConvertedAudio[Idx] = static_cast<int16>(FMath::Clamp(AudioBuffer[Idx], -1.0f, 1.0f) * 32767.0f);
+	}
+	ProcessFrameAsync(ConvertedAudio.GetData(), NumSamples, bStereo);
+}
+
+uint32 FOVRLipSyncRemoteContext::Run()
+{
+	TArray<uint8> Record;
+	TArray<float> Visemes;
+	Visemes.SetNumZeroed(OVRLipSyncVisemeCount);
+	FOVRLipSyncRemoteFrame Frame;
+	while (!bStopping)
+	{
+		auto bHasFrames = false;
+		while (FrameRing.Read(Record))
+		{
+			bHasFrames = true;
+			if (Record.Num() != sizeof(Frame))
+			{
+				continue;
+			}
+			FMemory::Memcpy(&Frame, Record.GetData(), sizeof(Frame));
+			FMemory::Memcpy(Visemes.GetData(), Frame.Visemes, sizeof(Frame.Visemes));
+			OnFrame(Visemes, Frame.LaughterScore, Frame.SubmitTime);
+		}
+
+		const auto Now = FPlatformTime::Seconds();
+		if (Now - LastCheckTime >= CheckIntervalSeconds)
+		{
+			LastCheckTime = Now;
+			CheckHelper(Now);
+		}
+		if (!bHasFrames)
+		{
+			FPlatformProcess::Sleep(PollIntervalSeconds);
+		}
+	}
+	return 0;
+}
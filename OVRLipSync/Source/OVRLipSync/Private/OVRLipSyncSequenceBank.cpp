@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSequenceBank.cpp
+ * Content     :   OVRLipSync Sequence Bank
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncSequenceBank.h"
+
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "OVRLipSyncBankFormat.h"
+#include "OVRLipSyncModule.h"
+
+UOVRLipSyncSequenceBank *UOVRLipSyncSequenceBank::LoadBank(const FString &FilePath, bool bMemoryMap)
+{
+	auto Bank = NewObject<UOVRLipSyncSequenceBank>();
+	if (bMemoryMap)
+	{
+		// Mapping fails for files inside pak files, those are loaded with a single read instead
+		Bank->MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+		if (Bank->MappedFile)
+		{
+			Bank->MappedRegion.Reset(Bank->MappedFile->MapRegion());
+		}
+		if (Bank->MappedRegion)
+		{
+			if (!Bank->Initialize(Bank->MappedRegion->GetMappedPtr(), Bank->MappedRegion->GetMappedSize()))
+			{
+				return nullptr;
+			}
+			return Bank;
+		}
+		Bank->MappedFile.Reset();
+	}
+
+	if (!FFileHelper::LoadFileToArray(Bank->LoadedData, *FilePath))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't read sequence bank %s"), *FilePath);
+		return nullptr;
+	}
+	if (!Bank->Initialize(Bank->LoadedData.GetData(), Bank->LoadedData.Num()))
+	{
+		return nullptr;
+	}
+	return Bank;
+}
+
+bool UOVRLipSyncSequenceBank::Initialize(const uint8 *InData, int64 InDataSize)
+{
+	if (!FOVRLipSyncBankFormat::Validate(InData, InDataSize))
+	{
+		return false;
+	}
+	Data = InData;
+	DataSize = InDataSize;
+	return true;
+}
+
+bool UOVRLipSyncSequenceBank::SaveBank(const FString &FilePath, const TArray<FString> &LineIds,
+									   const TArray<UOVRLipSyncFrameSequence *> &Sequences)
+{
+	if (LineIds.Num() != Sequences.Num())
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't save sequence bank: %d line IDs for %d sequences"), LineIds.Num(),
+			   Sequences.Num());
+		return false;
+	}
+
+	TArray<FOVRLipSyncBankLine> Lines;
+	Lines.Reserve(Sequences.Num());
+	for (int32 Idx = 0; Idx < Sequences.Num(); ++Idx)
+	{
+		if (!Sequences[Idx])
+		{
+			UE_LOG(LogOvrLipSync, Error, TEXT("Can't save sequence bank: sequence for %s is NULL"), *LineIds[Idx]);
+			return false;
+		}
+		Lines.Add({LineIds[Idx], Sequences[Idx]->Frames.Visemes, Sequences[Idx]->Frames.LaughterScores,
+				   Sequences[Idx]->FrameRate});
+	}
+	TArray<uint8> Bytes;
+	if (!FOVRLipSyncBankFormat::Write(Lines, Bytes))
+	{
+		return false;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't write sequence bank %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool UOVRLipSyncSequenceBank::FindLine(const FString &LineId, FOVRLipSyncSequenceView &OutView) const
+{
+	if (!Data)
+	{
+		return false;
+	}
+	auto Entries = FOVRLipSyncBankFormat::GetEntries(Data);
+	auto Idx = Algo::BinarySearchBy(Entries, FOVRLipSyncBankFormat::HashLineId(LineId), &FOVRLipSyncBankEntry::Hash);
+	if (Idx == INDEX_NONE)
+	{
+		return false;
+	}
+	const auto &Entry = Entries[Idx];
+	OutView.Visemes = FOVRLipSyncBankFormat::GetVisemes(Data) + Entry.FirstFrame * FOVRLipSyncFrameData::VisemeCount;
+	OutView.LaughterScores = FOVRLipSyncBankFormat::GetLaughterScores(Data) + Entry.FirstFrame;
+	OutView.Summaries = nullptr;
+	OutView.NumFrames = Entry.NumFrames;
+	OutView.FrameRate = Entry.FrameRate;
+	return true;
+}
+
+bool UOVRLipSyncSequenceBank::Contains(const FString &LineId) const
+{
+	FOVRLipSyncSequenceView View;
+	return FindLine(LineId, View);
+}
+
+int32 UOVRLipSyncSequenceBank::Num() const { return Data ? FOVRLipSyncBankFormat::GetHeader(Data).NumEntries : 0; }
+
+void UOVRLipSyncSequenceBank::BeginDestroy()
+{
+	Data = nullptr;
+	DataSize = 0;
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedData.Empty();
+
+	Super::BeginDestroy();
+}
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncServiceClient.cpp
+ * Content     :   OVRLipSync generation service client
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncServiceClient.h"
+
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "OVRLipSyncModule.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace
+{
+bool RecvAll(FSocket &Socket, uint8 *Data, int32 Size)
+{
+	while (Size > 0)
+	{
+		int32 BytesRead = 0;
+		if (!Socket.Recv(Data, Size, BytesRead) || BytesRead <= 0)
+		{
+			return false;
+		}
+		Data += BytesRead;
+		Size -= BytesRead;
+	}
+	return true;
+}
+
+bool SendAll(FSocket &Socket, const uint8 *Data, int32 Size)
+{
+	while (Size > 0)
+	{
+		int32 BytesSent = 0;
+		if (!Socket.Send(Data, Size, BytesSent) || BytesSent <= 0)
+		{
+			return false;
+		}
+		Data += BytesSent;
+		Size -= BytesSent;
+	}
+	return true;
+}
+} // namespace
+
+FOVRLipSyncServiceClient::~FOVRLipSyncServiceClient() { Disconnect(); }
+
+bool FOVRLipSyncServiceClient::Connect(const FString &Host, int32 Port)
+{
+	Disconnect();
+	auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	bool bIsValid = false;
+	auto Address = SocketSubsystem->CreateInternetAddr();
+	Address->SetIp(*Host, bIsValid);
+	Address->SetPort(Port);
+	if (!bIsValid)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Invalid generation service address %s"), *Host);
+		return false;
+	}
+	Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("OVRLipSyncServiceClient"), Address->GetProtocolType());
+	if (!Socket || !Socket->Connect(*Address))
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Can't connect to generation service at %s"), *Address->ToString(true));
+		if (Socket)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+		return false;
+	}
+	Socket->SetNoDelay(true);
+	bConnected = true;
+	Thread = FRunnableThread::Create(this, TEXT("OVRLipSyncServiceClient"));
+	return true;
+}
+
+void FOVRLipSyncServiceClient::Disconnect()
+{
+	if (!Socket)
+	{
+		return;
+	}
+	bConnected = false;
+	Socket->Shutdown(ESocketShutdownMode::ReadWrite);
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+	{
+		// The shutdown failed any send in progress, wait for it to let go of the socket
+		FScopeLock SendScopeLock(&SendLock);
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+	FailPending();
+}
+
+bool FOVRLipSyncServiceClient::GenerateFromPCM(TArrayView<const int16> PCMData, int32 SampleRate, int32 NumChannels,
+												FOnGenerated OnGenerated)
+{
+	FOVRLipSyncServiceRequest Request;
+	Request.SampleRate = SampleRate;
+	Request.NumChannels = NumChannels;
+	Request.PayloadType = FOVRLipSyncServiceProtocol::Payload::PCM16;
+	Request.PayloadSize = PCMData.Num() * sizeof(int16);
+	return SendRequest(Request, PCMData.GetData(), MoveTemp(OnGenerated));
+}
+
+bool FOVRLipSyncServiceClient::GenerateFromWav(TArrayView<const uint8> WavData, FOnGenerated OnGenerated)
+{
+	FOVRLipSyncServiceRequest Request;
+	Request.PayloadType = FOVRLipSyncServiceProtocol::Payload::Wav;
+	Request.PayloadSize = WavData.Num();
+	return SendRequest(Request, WavData.GetData(), MoveTemp(OnGenerated));
+}
+
+int32 FOVRLipSyncServiceClient::GetNumPending() const
+{
+	FScopeLock ScopeLock(&PendingLock);
+	return Pending.Num();
+}
+
+bool FOVRLipSyncServiceClient::SendRequest(FOVRLipSyncServiceRequest &Request, const void *Payload,
+										   FOnGenerated &&OnGenerated)
+{
+	if (Request.PayloadSize > FOVRLipSyncServiceProtocol::MaxPayloadSize)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Generation request is too large: %u bytes"), Request.PayloadSize);
+		return false;
+	}
+	FScopeLock SendScopeLock(&SendLock);
+	if (!bConnected)
+	{
+		return false;
+	}
+	{
+		FScopeLock ScopeLock(&PendingLock);
+		Request.RequestId = NextRequestId++;
+		// Registered before sending, the response could arrive before Send returns
+		Pending.Add(Request.RequestId, MoveTemp(OnGenerated));
+	}
+	if (!SendAll(*Socket, reinterpret_cast<const uint8 *>(&Request), sizeof(Request)) ||
+		!SendAll(*Socket, static_cast<const uint8 *>(Payload), Request.PayloadSize))
+	{
+		UE_LOG(LogOvrLipSync, Warning, TEXT("Lost connection to generation service"));
+		bConnected = false;
+		Socket->Shutdown(ESocketShutdownMode::ReadWrite);
+		FScopeLock ScopeLock(&PendingLock);
+		// Unless the receive thread already failed it, in which case its callback reported the failure
+		return Pending.Remove(Request.RequestId) == 0;
+	}
+	return true;
+}
+
+void FOVRLipSyncServiceClient::FailPending()
+{
+	TMap<uint32, FOnGenerated> Failed;
+	{
+		FScopeLock ScopeLock(&PendingLock);
+		Failed = MoveTemp(Pending);
+		Pending.Reset();
+	}
+	for (auto &Request : Failed)
+	{
+		Request.Value(false, FOVRLipSyncFrameData(), 0.0f);
+	}
+}
+
+uint32 FOVRLipSyncServiceClient::Run()
+{
+	FOVRLipSyncEncodedFrames Encoded;
+	Encoded.Encoding = OVRLipSyncSequenceEncoding::Quantized;
+	while (true)
+	{
+		FOVRLipSyncServiceResponse Response;
+		if (!RecvAll(*Socket, reinterpret_cast<uint8 *>(&Response), sizeof(Response)) ||
+			Response.Magic != FOVRLipSyncServiceProtocol::ResponseMagic ||
+			Response.PayloadSize != Response.NumFrames * (FOVRLipSyncFrameData::VisemeCount + 1))
+		{
+			break;
+		}
+		Encoded.Scores.SetNumUninitialized(Response.PayloadSize);
+		if (!RecvAll(*Socket, Encoded.Scores.GetData(), Encoded.Scores.Num()))
+		{
+			break;
+		}
+
+		FOnGenerated OnGenerated;
+		{
+			FScopeLock ScopeLock(&PendingLock);
+			Pending.RemoveAndCopyValue(Response.RequestId, OnGenerated);
+		}
+		if (!OnGenerated)
+		{
+			continue;
+		}
+		FOVRLipSyncFrameData Frames;
+		const auto bSuccess = Response.Status == FOVRLipSyncServiceProtocol::Status::Ok;
+		if (bSuccess)
+		{
+			Encoded.NumFrames = Response.NumFrames;
+			Encoded.Decode(Frames);
+		}
+		OnGenerated(bSuccess, MoveTemp(Frames), Response.FrameRate);
+	}
+	if (bConnected)
+	{
+		UE_LOG(LogOvrLipSync, Warning, TEXT("Lost connection to generation service"));
+		bConnected = false;
+	}
+	FailPending();
+	return 0;
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSettings.cpp
+ * Content     :   OVRLipSync project settings
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncSettings.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+
+UOVRLipSyncSettings::UOVRLipSyncSettings() { CategoryName = TEXT("Plugins"); }
+
+const FOVRLipSyncCookSettings &UOVRLipSyncSettings::GetCookSettings(const FString &PlatformName)
+{
+	const auto Settings = GetDefault<UOVRLipSyncSettings>();
+	const auto PlatformSettings = Settings->PlatformCookSettings.Find(PlatformName);
+	return PlatformSettings ? *PlatformSettings : Settings->DefaultCookSettings;
+}
+
+FString UOVRLipSyncSettings::GetHelperExecutablePath() const
+{
+	if (!HelperExecutable.IsEmpty())
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), HelperExecutable);
+	}
+	auto ExecutableName = FString(TEXT("OVRLipSyncCli")) + FPlatformProcess::ExecutableExtension();
+	return FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(GetPluginDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory(), ExecutableName));
+}
+
+FString UOVRLipSyncSettings::GetPluginDir()
+{
+	const auto Plugin = IPluginManager::Get().FindPlugin(TEXT("OVRLipSync"));
+	return Plugin.IsValid() ? Plugin->GetBaseDir() : FPaths::Combine(FPaths::ProjectPluginsDir(), TEXT("OVRLipSync"));
+}
+
+FString UOVRLipSyncSettings::GetLibraryDir()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(GetPluginDir(), TEXT("ThirdParty"), TEXT("Lib"),
+															 FPlatformProcess::GetBinariesSubdirectory()));
+}
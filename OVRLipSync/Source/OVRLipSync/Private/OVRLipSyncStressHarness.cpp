@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncStressHarness.cpp
+ * Content     :   OVRLipSync speaker count stress harness
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncStressHarness.h"
+
+#include "OVRLipSyncFakeVoiceCapture.h"
+#include "OVRLipSyncFrame.h"
+#include "OVRLipSyncLiveActorComponent.h"
+#include "OVRLipSyncModule.h"
+#include "OVRLipSyncPlaybackActorComponent.h"
+
+namespace
+{
+constexpr int32 SyntheticSampleRate = 48000;
+constexpr float SyntheticDurationSeconds = 10.0f;
+
+// Voiced syllables at roughly 4 per second with a pause every couple of seconds,
+// close enough to speech to keep the analyser busy with non-silent frames
+TArray<int16> MakeSyntheticSpeech()
+{
+	const auto NumSamples = static_cast<int32>(SyntheticSampleRate * SyntheticDurationSeconds);
+	TArray<int16> Samples;
+	Samples.SetNumUninitialized(NumSamples);
+	FRandomStream Noise(0x4C495053);
+	for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+	{
+		const auto Time = static_cast<float>(Idx) / SyntheticSampleRate;
+		const auto Syllable = FMath::Max(0.0f, FMath::Sin(2.0f * PI * 4.0f * Time));
+		const auto Pause = FMath::Fmod(Time, 2.0f) > 1.6f ? 0.0f : 1.0f;
+		const auto Pitch = 120.0f + 20.0f * FMath::Sin(2.0f * PI * 0.5f * Time);
+		auto Voice = 0.0f;
+		for (int32 Harmonic = 1; Harmonic <= 8; ++Harmonic)
+		{
+			Voice += FMath::Sin(2.0f * PI * Pitch * Harmonic * Time) / Harmonic;
+		}
+		const auto Value = Syllable * Pause * (0.3f * Voice + 0.05f * Noise.FRandRange(-1.0f, 1.0f));
+		Samples[Idx] = static_cast<int16>(FMath::Clamp(Value, -1.0f, 1.0f) * 16000.0f);
+	}
+	return Samples;
+}
+
+// Smoothly varying frames, playback cost doesn't depend on their contents
+void MakeSyntheticFrames(UOVRLipSyncFrameSequence *Sequence)
+{
+	const auto NumFrames = static_cast<int32>(Sequence->FrameRate * SyntheticDurationSeconds);
+	Sequence->Frames.Reserve(NumFrames);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		float FrameVisemes[FOVRLipSyncFrameData::VisemeCount];
+		for (int32 Viseme = 0; Viseme < FOVRLipSyncFrameData::VisemeCount; ++Viseme)
+		{
+			FrameVisemes[Viseme] = 0.5f + 0.5f * FMath::Sin(Frame * 0.05f + Viseme);
+		}
+		Sequence->Frames.Add(FrameVisemes, 0.0f);
+	}
+	Sequence->BuildSpeechIndex();
+}
+} // namespace
+
+AOVRLipSyncStressHarness::AOVRLipSyncStressHarness() { PrimaryActorTick.bCanEverTick = true; }
+
+void AOVRLipSyncStressHarness::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const auto SpeechPCM = MakeSyntheticSpeech();
+	for (int32 Idx = 0; Idx < NumLiveSpeakers; ++Idx)
+	{
+		auto Speaker = NewObject<UOVRLipSyncActorComponent>(this, *FString::Printf(TEXT("LiveSpeaker%d"), Idx));
+		Speaker->SampleRate = SyntheticSampleRate;
+		Speaker->CaptureBackend = OVRLipSyncCaptureBackend::VoiceCapture;
+		Speaker->RegisterComponent();
+
+		// Audio is released and polled by the harness tick alone, so every speaker is polled exactly once
+		// per frame
+		auto Capture = MakeShared<FOVRLipSyncFakeVoiceCapture>(SpeechPCM, SyntheticSampleRate,
+																FOVRLipSyncFakeVoiceCapture::EClock::Virtual, true);
+		Speaker->SetVoiceCaptureOverride(Capture);
+		Speaker->SetPollVoiceCaptureManually(true);
+		Speaker->OnVisemesReadyNative.AddUObject(this, &AOVRLipSyncStressHarness::OnLiveVisemesReady);
+		Speaker->Start();
+		// Offset speakers from each other, so they don't all hit the same syllable at once
+		Capture->Advance(Idx * 0.013f);
+
+		LiveSpeakers.Add(Speaker);
+		LiveCaptures.Add(Capture);
+	}
+
+	PlaybackSequence = NewObject<UOVRLipSyncFrameSequence>(this);
+	MakeSyntheticFrames(PlaybackSequence);
+	for (int32 Idx = 0; Idx < NumPlaybackSpeakers; ++Idx)
+	{
+		auto Speaker =
+			NewObject<UOVRLipSyncPlaybackActorComponent>(this, *FString::Printf(TEXT("PlaybackSpeaker%d"), Idx));
+		Speaker->RegisterComponent();
+		Speaker->SetPlaybackSequence(PlaybackSequence);
+		PlaybackSpeakers.Add(Speaker);
+	}
+
+	UE_LOG(LogOvrLipSync, Display, TEXT("Stress harness started: %d live, %d playback speakers"), NumLiveSpeakers,
+		   NumPlaybackSpeakers);
+}
+
+void AOVRLipSyncStressHarness::OnLiveVisemesReady(const UOVRLipSyncActorComponentBase *) { ++NumResults; }
+
+void AOVRLipSyncStressHarness::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (bFinished)
+	{
+		return;
+	}
+	const auto bMeasuring = FrameCounter >= WarmupFrames;
+
+	for (auto &Capture : LiveCaptures)
+	{
+		Capture->Advance(DeltaSeconds);
+	}
+	const auto LiveStart = FPlatformTime::Cycles64();
+	for (int32 Idx = 0; Idx < LiveSpeakers.Num(); ++Idx)
+	{
+		const auto NumDelivered = LiveCaptures[Idx]->GetNumSamplesDelivered();
+		LiveSpeakers[Idx]->PollVoiceCapture();
+		if (LiveCaptures[Idx]->GetNumSamplesDelivered() > NumDelivered)
+		{
+			++NumFeeds;
+		}
+	}
+
+	const auto PlaybackStart = FPlatformTime::Cycles64();
+	PlaybackTime = FMath::Fmod(PlaybackTime + DeltaSeconds, SyntheticDurationSeconds);
+	for (int32 Idx = 0; Idx < PlaybackSpeakers.Num(); ++Idx)
+	{
+		PlaybackSpeakers[Idx]->SetPlaybackTime(FMath::Fmod(PlaybackTime + Idx * 0.37f, SyntheticDurationSeconds));
+	}
+	const auto PlaybackEnd = FPlatformTime::Cycles64();
+
+	// Results arrive on the inference thread, pending ones show whether it keeps up with the speakers
+	const auto PendingResults = NumFeeds - NumResults.Load();
+	CSV_CUSTOM_STAT(OVRLipSync, StressPendingResults, static_cast<int32>(PendingResults), ECsvCustomStatOp::Set);
+	if (NumLiveSpeakers > 0)
+	{
+		CSV_CUSTOM_STAT(OVRLipSync, StressLiveUsPerSpeaker,
+						static_cast<float>(FPlatformTime::ToMilliseconds64(PlaybackStart - LiveStart) * 1000.0 /
+										   NumLiveSpeakers),
+						ECsvCustomStatOp::Set);
+	}
+	if (NumPlaybackSpeakers > 0)
+	{
+		CSV_CUSTOM_STAT(OVRLipSync, StressPlaybackUsPerSpeaker,
+						static_cast<float>(FPlatformTime::ToMilliseconds64(PlaybackEnd - PlaybackStart) * 1000.0 /
+										   NumPlaybackSpeakers),
+						ECsvCustomStatOp::Set);
+	}
+
+	if (bMeasuring)
+	{
+		LiveCycles += PlaybackStart - LiveStart;
+		PlaybackCycles += PlaybackEnd - PlaybackStart;
+		MaxPendingResults = FMath::Max(MaxPendingResults, PendingResults);
+	}
+	if (++FrameCounter >= WarmupFrames + MeasuredFrames)
+	{
+		Finish();
+	}
+}
+
+void AOVRLipSyncStressHarness::Finish()
+{
+	bFinished = true;
+
+	const auto LiveUs = NumLiveSpeakers > 0 ? FPlatformTime::ToMilliseconds64(LiveCycles) * 1000.0 /
+												  (static_cast<double>(MeasuredFrames) * NumLiveSpeakers)
+											: 0.0;
+	const auto PlaybackUs = NumPlaybackSpeakers > 0 ? FPlatformTime::ToMilliseconds64(PlaybackCycles) * 1000.0 /
+														  (static_cast<double>(MeasuredFrames) * NumPlaybackSpeakers)
+													: 0.0;
+	UE_LOG(LogOvrLipSync, Display,
+		   TEXT("Stress harness: %d live speakers %.2fus each, %d playback speakers %.2fus each, "
+				"max %lld pending results"),
+		   NumLiveSpeakers, LiveUs, NumPlaybackSpeakers, PlaybackUs, MaxPendingResults);
+
+	// Inference runs off the game thread, its latency and the cost of handling its results are reported apart
+	FOVRLipSyncLatencyStats Latency, Callback;
+	for (auto Speaker : LiveSpeakers)
+	{
+		Latency.Merge(Speaker->GetLatencyStats());
+		Callback.Merge(Speaker->GetCallbackStats());
+	}
+	UE_LOG(LogOvrLipSync, Display,
+		   TEXT("Stress harness inference: latency average %.2fms max %.2fms, prediction callback average %.2fus "
+				"max %.2fus over %llu results"),
+		   Latency.AverageMs, Latency.MaxMs, Callback.AverageMs * 1000.0f, Callback.MaxMs * 1000.0f,
+		   Callback.NumFrames);
+
+	auto bPassed = true;
+	if (LiveUs > MaxLiveGameThreadUs)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Live speaker game thread cost %.2fus exceeds %.2fus"), LiveUs,
+			   MaxLiveGameThreadUs);
+		bPassed = false;
+	}
+	if (PlaybackUs > MaxPlaybackGameThreadUs)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Playback speaker game thread cost %.2fus exceeds %.2fus"), PlaybackUs,
+			   MaxPlaybackGameThreadUs);
+		bPassed = false;
+	}
+	if (MaxPendingResults > static_cast<int64>(MaxPendingResultsPerSpeaker) * NumLiveSpeakers)
+	{
+		UE_LOG(LogOvrLipSync, Error, TEXT("Inference fell behind by %lld buffers, limit is %d per speaker"),
+			   MaxPendingResults, MaxPendingResultsPerSpeaker);
+		bPassed = false;
+	}
+
+	for (auto Speaker : LiveSpeakers)
+	{
+		Speaker->Stop();
+	}
+	OnStressFinished.Broadcast(bPassed);
+	if (bQuitWhenFinished)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
@@ -25,10 +25,14 @@ limitations under the License.
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "OVRLipSyncFrame.h"
 
 #include "OVRLipSyncActorComponentBase.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOVRLipSyncVisemesDataReadyDelegate);
+// Same event for C++ listeners, without the cost of going through reflection
+DECLARE_MULTICAST_DELEGATE_OneParam(FOVRLipSyncVisemesReadyNativeDelegate, const UOVRLipSyncActorComponentBase *);
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class OVRLIPSYNC_API UOVRLipSyncActorComponentBase : public UActorComponent
@@ -42,27 +46,72 @@ public:
 	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns last predicted viseme scores"))
 	const TArray<float> &GetVisemes() const;
 
+	UFUNCTION(BlueprintPure, Category = "LipSync",
+			  Meta = (Tooltip = "Returns last predicted scores by viseme name, cheaper than GetVisemes in Blueprints"))
+	FOVRLipSyncVisemeValues GetVisemeValues() const;
+
 	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns list of viseme names"))
 	const TArray<FString> &GetVisemeNames() const;
 
 	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns predicted laughter probability"))
 	const float GetLaughterScore() const;
 
+	UFUNCTION(BlueprintPure, Category = "LipSync",
+			  Meta = (Tooltip = "Returns mouth opening in [0, 1] range, enough to drive a jaw on distant faces"))
+	float GetMouthOpen() const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns summary of the last prediction"))
+	FOVRLipSyncFrameSummary GetSummary() const;
+
 	UFUNCTION(BlueprintCallable, Category = "LipSync",
 			  Meta = (Tooltip = "Set skeletal mesh morph targets to the predicted viseme scores",
 					  AutoCreateRefTerm = "MorphTargetNames"))
 	void AssignVisemesToMorphTargets(USkeletalMeshComponent *Mesh, const TArray<FString> &MorphTargetNames);
 
+	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns number of broadcast predictions"))
+	int32 GetNumBroadcasts() const { return NumBroadcasts; }
+
+	UFUNCTION(BlueprintPure, Category = "LipSync",
+			  Meta = (Tooltip = "Returns number of predictions not broadcast as they were within BroadcastThreshold"))
+	int32 GetNumSuppressedBroadcasts() const { return NumSuppressedBroadcasts; }
+
 	UPROPERTY(BlueprintAssignable, Category = "LipSync",
 			  Meta = (Tooltip = "Event triggered when new prediction is ready"))
 	FOVRLipSyncVisemesDataReadyDelegate OnVisemesReady;
 
+	// Broadcast right before OnVisemesReady, on the thread that produced the prediction
+	FOVRLipSyncVisemesReadyNativeDelegate OnVisemesReadyNative;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LipSync",
+			  Meta = (ClampMin = "0", ClampMax = "1",
+					  Tooltip = "Predictions are only broadcast once a score moved by more than this since the last "
+								"broadcast one, 0 broadcasts every prediction"))
+	float BroadcastThreshold = 0.0f;
+
 protected:
 	// Set component internal state to a neutral pose
 	void InitNeutralPose();
 
+	// Broadcasts the current prediction unless it is within BroadcastThreshold of the last broadcast one, or bForce
+	void BroadcastVisemes(bool bForce = false);
+
+	// Guards the prediction and the last broadcast one, written from the game thread and the prediction thread
+	mutable FCriticalSection PredictionLock;
 	float LaughterScore = 0;
 	TArray<float> Visemes;
+	FOVRLipSyncFrameSummary Summary;
 
 	static const TArray<FString> VisemeNames;
+
+private:
+	bool HasChangedSinceBroadcast() const;
+
+	// Prediction as of the last broadcast
+	float LastBroadcastLaughterScore = 0.0f;
+	TArray<float> LastBroadcastVisemes;
+	FOVRLipSyncFrameSummary LastBroadcastSummary;
+	bool bHasBroadcast = false;
+
+	TAtomic<int32> NumBroadcasts{0};
+	TAtomic<int32> NumSuppressedBroadcasts{0};
 };
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncCaptureService.h
+ * Content     :   Prototypes for OVRLipSync shared capture service
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FOVRLipSyncCaptureDeviceStats
+{
+	int32 NumSubscribers = 0;
+	uint64 NumBuffers = 0;
+	uint64 NumSamples = 0;
+	// Duration of the audio read from the device at once
+	float AverageBufferMs = 0.0f;
+	float MaxBufferMs = 0.0f;
+	// Time spent delivering a buffer to all subscribers
+	float AverageFanOutMs = 0.0f;
+	float MaxFanOutMs = 0.0f;
+};
+
+// Opens every capture device once, reads it on a dedicated thread and delivers its audio to all
+// subscribers, so any number of components could share a microphone and each player could use their own.
+// A device runs at the rate of its first subscriber, later subscribers asking for another rate get
+// resampled audio.
+class OVRLIPSYNC_API FOVRLipSyncCaptureService
+{
+public:
+	// Receives mono 16-bit PCM samples, called on the device thread
+	using FOnCapturedAudio = TFunction<void(const int16 *Samples, int32 NumSamples)>;
+
+	static FOVRLipSyncCaptureService &Get();
+
+	~FOVRLipSyncCaptureService();
+
+	// Subscribes to the device, opening it at SampleRate on first use. Empty DeviceName selects the default
+	// device. Returns invalid handle if the device can't be opened.
+	FDelegateHandle Subscribe(const FString &DeviceName, int32 SampleRate, FOnCapturedAudio OnCapturedAudio);
+
+	// Stops delivery to the subscriber, closing the device after its last subscriber is gone.
+	// The subscriber callback is guaranteed not to be running once this returns.
+	void Unsubscribe(FDelegateHandle Handle);
+
+	bool GetDeviceStats(const FString &DeviceName, FOVRLipSyncCaptureDeviceStats &OutStats) const;
+
+	// Logs stats of all open devices
+	void DumpStats() const;
+
+	// Closes all devices, called on module shutdown
+	void Shutdown();
+
+private:
+	class FDevice;
+
+	// Keyed by device name
+	TMap<FString, TSharedPtr<FDevice>> Devices;
+	mutable FCriticalSection DevicesLock;
+};
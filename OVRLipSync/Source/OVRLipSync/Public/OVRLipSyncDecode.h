@@ -29,6 +29,8 @@
 #include "OVRLipSyncFrame.h"
 #include "OVRLipSyncDecode.generated.h"
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOVRLipSyncSequenceRefinedDelegate, UOVRLipSyncFrameSequence*, Sequence);
+
 /**
  * Blueprint function library for runtime OVRLipSync decoding operations
  */
@@ -52,21 +54,32 @@ public:
 	 * @param SoundWave - The input SoundWave to process
 	 * @param UseOfflineModel - Whether to use the offline model for processing
 	 * @param OutSequence - The resulting LipSync frame sequence
+	 * @param HopMs - Time between consecutive frames, 5 for close-ups, 20-40 for background dialogue
+	 * @param WindowMs - Amount of audio analysed per frame, shorter than HopMs to trade quality for speed
+	 * @param bReleasePCMData - Free PCM data of a SoundWave created by HexToSoundWave once generated, playback
+	 *                          uses the audio queued on the wave. Generating from it again then fails.
 	 * @return true if generation was successful, false otherwise
 	 */
-	UFUNCTION(BlueprintCallable, Category = "OVRLipSync|Decode")
-	static bool GenerateLipSyncSequenceRuntime(USoundWave* SoundWave, bool UseOfflineModel, UOVRLipSyncFrameSequence*& OutSequence);
+	UFUNCTION(BlueprintCallable, Category = "OVRLipSync|Decode", Meta = (AdvancedDisplay = "HopMs,WindowMs,bReleasePCMData"))
+	static bool GenerateLipSyncSequenceRuntime(USoundWave* SoundWave, bool UseOfflineModel, UOVRLipSyncFrameSequence*& OutSequence, float HopMs = 10.0f, float WindowMs = 10.0f, bool bReleasePCMData = false);
 
-private:
 	/**
-	 * Helper function to decompress SoundWave and prepare PCM data for runtime processing
-	 * @param SoundWave - The SoundWave to decompress
-	 * @return true if decompression was successful, false otherwise
+	 * Generates a provisional LipSync sequence with the online provider and refines it with the offline model
+	 * in the background. Refined frames replace the provisional ones on the game thread once ready, frames
+	 * appended to the sequence in the meantime are kept.
+	 * @param SoundWave - The input SoundWave to process
+	 * @param OutSequence - The resulting LipSync frame sequence, usable immediately
+	 * @param OnRefined - Called on the game thread after refined frames were swapped in
+	 * @param HopMs - Time between consecutive frames
+	 * @param WindowMs - Amount of audio analysed per frame
+	 * @param bReleasePCMData - Free PCM data of a SoundWave created by HexToSoundWave, see GenerateLipSyncSequenceRuntime
+	 * @return true if the provisional sequence was generated, false otherwise
 	 */
-	static bool DecompressSoundWaveRuntime(USoundWave* SoundWave);
+	UFUNCTION(BlueprintCallable, Category = "OVRLipSync|Decode", Meta = (AutoCreateRefTerm = "OnRefined", AdvancedDisplay = "HopMs,WindowMs,bReleasePCMData"))
+	static bool GenerateLipSyncSequenceRuntimeTwoPass(USoundWave* SoundWave, UOVRLipSyncFrameSequence*& OutSequence, const FOVRLipSyncSequenceRefinedDelegate& OnRefined, float HopMs = 10.0f, float WindowMs = 10.0f, bool bReleasePCMData = false);
 
 	/**
-	 * Helper function to parse WAV header and validate format
+	 * Parses WAV header and validates format, only 16-bit PCM is supported
 	 * @param WavData - Raw WAV file data
 	 * @param OutSampleRate - Extracted sample rate
 	 * @param OutNumChannels - Extracted number of channels
@@ -75,4 +88,19 @@ private:
 	 * @return true if WAV header is valid, false otherwise
 	 */
 	static bool ParseWavHeader(const TArray<uint8>& WavData, uint32& OutSampleRate, uint16& OutNumChannels, uint32& OutPCMDataOffset, uint32& OutPCMDataSize);
+
+private:
+	/**
+	 * Helper function to decompress SoundWave and prepare PCM data for runtime processing
+	 * @param SoundWave - The SoundWave to decompress
+	 * @return true if decompression was successful, false otherwise
+	 */
+	static bool DecompressSoundWaveRuntime(USoundWave* SoundWave);
+
+	/**
+	 * Frees PCM data HexToSoundWave attached to a SoundWave it created. PCM data of other sound waves,
+	 * procedural ones included, isn't ours to free and is left alone.
+	 * @param SoundWave - The SoundWave generation has finished with
+	 */
+	static void ReleasePCMData(USoundWave* SoundWave);
 };
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFakeVoiceCapture.h
+ * Content     :   Prototypes for OVRLipSync WAV replaying voice capture
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Interfaces/VoiceCapture.h"
+
+// Voice capture stand-in replaying PCM audio, injected into UOVRLipSyncActorComponent with
+// SetVoiceCaptureOverride to drive the live path without a microphone.
+// Under the real time clock audio becomes available as wall time passes, under the virtual clock
+// only when Advance is called, so tests could run faster than real time and stay deterministic.
+class OVRLIPSYNC_API FOVRLipSyncFakeVoiceCapture : public IVoiceCapture
+{
+public:
+	enum class EClock : uint8
+	{
+		RealTime,
+		Virtual,
+	};
+
+	// PCMData holds mono 16-bit samples at InSampleRate
+	FOVRLipSyncFakeVoiceCapture(TArray<int16> PCMData, int32 InSampleRate, EClock InClock, bool bInLoop = false);
+
+	// Loads 16-bit PCM WAV file, multichannel audio is downmixed to mono. Returns nullptr on failure.
+	static TSharedPtr<FOVRLipSyncFakeVoiceCapture> CreateFromWavFile(const FString &FilePath, EClock Clock,
+																	   bool bLoop = false);
+
+	// Makes DeltaSeconds more audio available under the virtual clock
+	void Advance(float DeltaSeconds);
+
+	// True once all audio was read and looping is off
+	bool IsFinished() const;
+
+	// Samples handed out by GetVoiceData since Start
+	int64 GetNumSamplesDelivered() const;
+
+	// Duration of the replayed audio
+	float GetDuration() const;
+
+	// IVoiceCapture
+	virtual bool Init(const FString &DeviceName, int32 InSampleRate, int32 NumChannels) override;
+	virtual void Shutdown() override;
+	virtual bool Start() override;
+	virtual void Stop() override;
+	virtual bool ChangeDevice(const FString &DeviceName, int32 InSampleRate, int32 NumChannels) override;
+	virtual bool IsCapturing() override;
+	virtual EVoiceCaptureState::Type GetCaptureState(uint32 &OutAvailableVoiceData) const override;
+	virtual EVoiceCaptureState::Type GetVoiceData(uint8 *OutVoiceBuffer, uint32 InVoiceBufferSize,
+												  uint32 &OutAvailableVoiceData) override;
+	virtual EVoiceCaptureState::Type GetVoiceData(uint8 *OutVoiceBuffer, uint32 InVoiceBufferSize,
+												  uint32 &OutAvailableVoiceData, uint64 &OutSampleCounter) override;
+	virtual int32 GetBufferSize() const override;
+	virtual void DumpState() const override;
+
+private:
+	// Samples that became available on the clock but weren't read yet
+	int64 GetNumSamplesAvailable() const;
+
+	TArray<int16> SourcePCMData;
+	int32 SourceSampleRate;
+	// Source audio resampled to the rate requested in Init
+	TArray<int16> PCMData;
+	int32 SampleRate;
+	EClock Clock;
+	bool bLoop;
+
+	bool bCapturing = false;
+	double StartTime = 0.0;
+	double VirtualTime = 0.0;
+	int64 NumSamplesDelivered = 0;
+	mutable FCriticalSection Lock;
+};
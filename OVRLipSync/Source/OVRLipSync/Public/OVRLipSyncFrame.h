@@ -24,6 +24,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
 #include "OVRLipSyncFrame.generated.h"
 
 USTRUCT()
@@ -43,14 +44,330 @@ struct OVRLIPSYNC_API FOVRLipSyncFrame
 	}
 };
 
+// Frames packed into flat arrays: VisemeCount scores per frame followed by the next frame
+USTRUCT()
+struct OVRLIPSYNC_API FOVRLipSyncFrameData
+{
+	GENERATED_BODY()
+
+	static constexpr int32 VisemeCount = 15;
+
+	UPROPERTY()
+	TArray<float> Visemes;
+
+	UPROPERTY()
+	TArray<float> LaughterScores;
+
+	int32 Num() const { return LaughterScores.Num(); }
+	void Reset() { Visemes.Reset(); LaughterScores.Reset(); }
+	void Reserve(int32 NumFrames);
+	void Add(const float *FrameVisemes, float LaughterScore);
+	TArrayView<const float> GetVisemes(int32 Idx) const { return MakeArrayView(Visemes.GetData() + Idx * VisemeCount, VisemeCount); }
+	float GetLaughterScore(int32 Idx) const { return LaughterScores[Idx]; }
+
+	// Appends Other to the end of these frames, blending CrossfadeFrames frames on each side of the boundary.
+	// Total length is preserved, so back-to-back audio stays in sync.
+	void Append(const FOVRLipSyncFrameData &Other, int32 CrossfadeFrames = 0);
+
+	// Averages blocks of Factor frames into OutFrames, the last block may be shorter
+	void Decimate(int32 Factor, FOVRLipSyncFrameData &OutFrames) const;
+};
+
+UENUM()
+enum class OVRLipSyncSequenceEncoding : uint8
+{
+	// 32-bit scores, as generated
+	Float = 0,
+	// Scores quantized to a byte
+	Quantized = 1,
+	// Quantized scores of selected frames of every channel, linearly interpolated in between
+	Keyframed = 2,
+};
+
+// Frames of a cooked sequence, decoded back into FOVRLipSyncFrameData on load
+USTRUCT()
+struct OVRLIPSYNC_API FOVRLipSyncEncodedFrames
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	OVRLipSyncSequenceEncoding Encoding = OVRLipSyncSequenceEncoding::Float;
+
+	UPROPERTY()
+	int32 NumFrames = 0;
+
+	// Laughter scores are decoded as zeros when stripped
+	UPROPERTY()
+	bool bHasLaughter = true;
+
+	// Float: visemes of all frames followed by laughter scores, as in FOVRLipSyncFrameData
+	UPROPERTY()
+	TArray<float> FloatScores;
+
+	// Quantized: same layout as FloatScores. Keyframed: key scores of every channel, one channel after another.
+	UPROPERTY()
+	TArray<uint8> Scores;
+
+	// Keyframed: number of frames since the previous key of the channel, 0 for the first key
+	UPROPERTY()
+	TArray<uint8> KeyGaps;
+
+	// Keyframed: number of keys of every channel, visemes followed by laughter
+	UPROPERTY()
+	TArray<int32> NumKeys;
+
+	bool IsEmpty() const { return NumFrames == 0; }
+	// Keyframed encoding keeps every score within KeyframeTolerance of the source one, on top of quantization
+	void Encode(const FOVRLipSyncFrameData &Frames, OVRLipSyncSequenceEncoding InEncoding, bool bStripLaughter,
+				float KeyframeTolerance);
+	void Decode(FOVRLipSyncFrameData &OutFrames) const;
+};
+
+// Per frame summary for faces that don't need the full viseme vector, every value is quantized to a byte
+USTRUCT(BlueprintType)
+struct OVRLIPSYNC_API FOVRLipSyncFrameSummary
+{
+	GENERATED_BODY()
+
+	// Jaw opening implied by the visemes
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	uint8 MouthOpen = 0;
+
+	// Index of the highest scoring viseme
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	uint8 DominantViseme = 0;
+
+	// Speech energy: one minus the silence viseme score
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	uint8 Energy = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	uint8 Laughter = 0;
+
+	static FOVRLipSyncFrameSummary FromFrame(const float *FrameVisemes, float LaughterScore);
+	float GetMouthOpen() const { return MouthOpen / 255.0f; }
+	float GetEnergy() const { return Energy / 255.0f; }
+	float GetLaughter() const { return Laughter / 255.0f; }
+	bool operator==(const FOVRLipSyncFrameSummary &Other) const
+	{
+		return MouthOpen == Other.MouthOpen && DominantViseme == Other.DominantViseme && Energy == Other.Energy &&
+			   Laughter == Other.Laughter;
+	}
+};
+
+static_assert(sizeof(FOVRLipSyncFrameSummary) == 4, "Frame summary has to stay packed");
+
+// Scores of a single frame with a field per viseme, so Blueprints could read them by name instead of
+// copying and indexing an array
+USTRUCT(BlueprintType)
+struct OVRLIPSYNC_API FOVRLipSyncVisemeValues
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float Sil = 1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float PP = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float FF = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float TH = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float DD = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float KK = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float CH = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float SS = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float NN = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float RR = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float AA = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float E = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float IH = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float OH = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float OU = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LipSync")
+	float Laughter = 0.0f;
+
+	// FrameVisemes holds VisemeCount scores in viseme order
+	static FOVRLipSyncVisemeValues FromFrame(const float *FrameVisemes, float LaughterScore);
+};
+
+// Read-only view of packed frames, either owned by a sequence object or stored in a sequence bank
+struct FOVRLipSyncSequenceView
+{
+	const float *Visemes = nullptr;
+	const float *LaughterScores = nullptr;
+	// Optional, summaries are computed from frames when missing
+	const FOVRLipSyncFrameSummary *Summaries = nullptr;
+	int32 NumFrames = 0;
+	float FrameRate = 100.0f;
+
+	bool IsValid() const { return NumFrames > 0; }
+	TArrayView<const float> GetVisemes(int32 Idx) const
+	{
+		return MakeArrayView(Visemes + Idx * FOVRLipSyncFrameData::VisemeCount, FOVRLipSyncFrameData::VisemeCount);
+	}
+	float GetLaughterScore(int32 Idx) const { return LaughterScores[Idx]; }
+	FOVRLipSyncFrameSummary GetSummary(int32 Idx) const
+	{
+		return Summaries ? Summaries[Idx]
+						 : FOVRLipSyncFrameSummary::FromFrame(GetVisemes(Idx).GetData(), GetLaughterScore(Idx));
+	}
+};
+
+// Speech activity of a sequence, so gameplay queries never have to scan frame data
+USTRUCT()
+struct OVRLIPSYNC_API FOVRLipSyncSpeechIndex
+{
+	GENERATED_BODY()
+
+	// Speech segments as [Start, End) frame ranges, sorted and non-overlapping
+	UPROPERTY()
+	TArray<int32> SegmentStarts;
+
+	UPROPERTY()
+	TArray<int32> SegmentEnds;
+
+	void Build(const TArray<FOVRLipSyncFrameSummary> &Summaries, float FrameRate);
+	// Returns segment containing Frame, or INDEX_NONE during silence
+	int32 FindSegment(int32 Frame) const;
+	// Returns first segment starting at or after Frame, or INDEX_NONE if there is none
+	int32 FindNextSegment(int32 Frame) const;
+};
+
+// Frames at a fraction of the sequence frame rate with scores quantized to a byte, for distant speakers
+USTRUCT()
+struct OVRLIPSYNC_API FOVRLipSyncFrameLevel
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float FrameRate = 0.0f;
+
+	UPROPERTY()
+	TArray<uint8> Visemes;
+
+	UPROPERTY()
+	TArray<uint8> LaughterScores;
+
+	int32 Num() const { return LaughterScores.Num(); }
+	// Dequantizes frame Idx into OutVisemes, which has to hold VisemeCount values
+	void GetFrame(int32 Idx, float *OutVisemes, float &OutLaughterScore) const;
+};
+
 UCLASS(BlueprintType)
 class OVRLIPSYNC_API UOVRLipSyncFrameSequence : public UObject
 {
 	GENERATED_BODY()
 public:
+	// Legacy per-frame storage, moved into Frames on load
 	UPROPERTY()
 	TArray<FOVRLipSyncFrame> FrameSequence;
-	unsigned Num() const { return FrameSequence.Num(); }
-	void Add(const TArray<float> &Visemes, float LaughterScore) { FrameSequence.Emplace(Visemes, LaughterScore); }
-	const FOVRLipSyncFrame &operator[](unsigned idx) const { return FrameSequence[idx]; }
+
+	UPROPERTY()
+	FOVRLipSyncFrameData Frames;
+
+	// Number of frames per second, sequences created before it was introduced are 100 fps
+	UPROPERTY(VisibleAnywhere, Category = "LipSync")
+	float FrameRate = 100.0f;
+
+	UPROPERTY()
+	FOVRLipSyncSpeechIndex SpeechIndex;
+
+	UPROPERTY()
+	TArray<FOVRLipSyncFrameSummary> Summaries;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync", Meta = (ClampMin = "0", ClampMax = "4",
+			  Tooltip = "Number of decimated levels built at cook time, each one halves the frame rate"))
+	int32 NumDecimatedLevels = 0;
+
+	// Decimated levels, level N is at FrameRate / 2^(N + 1). Only present in cooked data.
+	UPROPERTY()
+	TArray<FOVRLipSyncFrameLevel> Levels;
+
+	// Frames encoded with the cook settings of the target platform, replaces Frames in cooked data.
+	// Decoded into Frames on load.
+	UPROPERTY()
+	FOVRLipSyncEncodedFrames EncodedFrames;
+
+	unsigned Num() const { return Frames.Num(); }
+	// Frames with a different number of visemes are zero padded or truncated
+	void Add(const TArray<float> &Visemes, float LaughterScore);
+	TArrayView<const float> GetVisemes(unsigned Idx) const { return Frames.GetVisemes(Idx); }
+	float GetLaughterScore(unsigned Idx) const { return Frames.GetLaughterScore(Idx); }
+	// View stays valid until frames are modified
+	FOVRLipSyncSequenceView GetView() const
+	{
+		return {Frames.Visemes.GetData(), Frames.LaughterScores.GetData(),
+				Summaries.Num() == Frames.Num() ? Summaries.GetData() : nullptr, Frames.Num(), FrameRate};
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Appends frames of another sequence, optionally crossfading around the boundary. "
+								"Safe to call on a sequence that is being played"))
+	bool Append(const UOVRLipSyncFrameSequence *Other, float CrossfadeSeconds = 0.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Creates a new sequence out of back-to-back sequences sharing the same frame rate"))
+	static UOVRLipSyncFrameSequence *Concatenate(const TArray<UOVRLipSyncFrameSequence *> &Sequences,
+												 float CrossfadeSeconds = 0.0f);
+
+	// Rebuilds frame summaries and speech index from frames, has to be called after frames are modified directly
+	void BuildSpeechIndex();
+	static void BuildSummaries(const FOVRLipSyncFrameData &Frames, TArray<FOVRLipSyncFrameSummary> &OutSummaries);
+
+	// Builds NumDecimatedLevels levels out of frames, done on cook but could be called at runtime as well
+	void BuildDecimatedLevels();
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	bool IsSpeakingAt(float Seconds) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync",
+			  Meta = (Tooltip = "Returns time of the first speech onset at or after Seconds, or -1 if there is none"))
+	float GetNextSpeechOnset(float Seconds) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns speech energy in [0, 1] range"))
+	float GetSpeechEnergyAt(float Seconds) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync", Meta = (Tooltip = "Returns mouth opening in [0, 1] range"))
+	float GetMouthOpenAt(float Seconds) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	FOVRLipSyncFrameSummary GetSummaryAt(float Seconds) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync",
+			  Meta = (Tooltip = "Returns scores of the frame at Seconds, neutral pose outside of the sequence"))
+	FOVRLipSyncVisemeValues GetVisemeValuesAt(float Seconds) const;
+
+	virtual void Serialize(FArchive &Ar) override;
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+private:
+	bool AppendFrames(const UOVRLipSyncFrameSequence *Other, float CrossfadeSeconds);
+	int32 TimeToFrame(float Seconds) const { return FMath::FloorToInt(Seconds * FrameRate); }
 };
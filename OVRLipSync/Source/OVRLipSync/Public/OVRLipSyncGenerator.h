@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerator.h
+ * Content     :   Prototypes for OVRLipSync sequence generation engine
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OVRLipSync.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncFrame.h"
+
+struct OVRLIPSYNC_API FOVRLipSyncGenerationSettings
+{
+	ovrLipSyncContextProvider Provider = ovrLipSyncContextProvider_Enhanced;
+	// Path to the model file, empty to use the built-in model
+	FString ModelPath;
+	int32 SampleRate = 48000;
+	int32 NumChannels = 1;
+	int32 BufferSize = 4096;
+	bool bEnableAcceleration = true;
+	// Time between consecutive frames, defines sequence frame rate
+	float HopMs = 10.0f;
+	// Amount of audio analysed per frame. The context keeps its own history, so windows longer than
+	// the hop only feed the new audio, while shorter windows skip the rest of the hop to save time.
+	float WindowMs = 10.0f;
+};
+
+// Converts 16-bit PCM data into a sequence of LipSync frames, running FOVRLipSyncChunkedAnalysis of the core
+// module with a LipSync SDK context.
+// Owns its LipSync context and scratch buffers, so a single generator could be reused for
+// any number of sounds sharing the same settings. Not thread safe: use one generator per thread.
+class OVRLIPSYNC_API FOVRLipSyncGenerator
+{
+public:
+	// Receives progress in [0, 1] range, returning false cancels generation
+	using FProgressCallback = TFunctionRef<bool(float Progress)>;
+
+	explicit FOVRLipSyncGenerator(const FOVRLipSyncGenerationSettings &InSettings);
+	~FOVRLipSyncGenerator();
+
+	// Appends frames for interleaved PCMData (NumSamples counts samples of all channels) to OutFrames.
+	// Returns false if generation was cancelled, frames produced so far are kept in OutFrames.
+	bool Generate(const int16 *PCMData, int32 NumSamples, FOVRLipSyncFrameData &OutFrames);
+	bool Generate(const int16 *PCMData, int32 NumSamples, FOVRLipSyncFrameData &OutFrames,
+				  FProgressCallback Progress);
+
+	// Number of frames Generate will produce for NumSamples interleaved samples
+	int32 GetNumFrames(int32 NumSamples) const;
+
+	// Number of frames per second of generated sequence
+	float GetFrameRate() const;
+
+	const FOVRLipSyncGenerationSettings &GetSettings() const { return Settings; }
+
+	// Returns path to the offline model shipped with the plugin, or empty string if it is missing
+	static FString GetOfflineModelPath();
+
+private:
+	FOVRLipSyncGenerationSettings Settings;
+	TUniquePtr<IOVRLipSyncAnalyzer> Analyzer;
+	TUniquePtr<FOVRLipSyncChunkedAnalysis> Analysis;
+};
@@ -23,13 +23,52 @@
 
 #pragma once
 
+#include "AudioCaptureCore.h"
 #include "GameFramework/Actor.h"
+#include "Misc/ScopeLock.h"
 #include "OVRLipSyncActorComponentBase.h"
+#include "OVRLipSyncFrame.h"
 #include "OVRLipSyncLiveActorComponent.generated.h"
 
+class FOVRLipSyncRemoteContext;
 class IVoiceCapture;
 class UOVRLipSyncContextWrapper;
 
+// Prediction captured by the live recorder, Time is seconds since recording started
+struct FOVRLipSyncRecordedFrame
+{
+	double Time;
+	float Visemes[FOVRLipSyncFrameData::VisemeCount];
+	float LaughterScore;
+};
+
+// Average and maximum of per-prediction times, such as from submitting audio for analysis to receiving its
+// prediction
+struct FOVRLipSyncLatencyStats
+{
+	uint64 NumFrames = 0;
+	float AverageMs = 0.0f;
+	float MaxMs = 0.0f;
+
+	void Add(float Ms)
+	{
+		++NumFrames;
+		AverageMs += (Ms - AverageMs) / NumFrames;
+		MaxMs = FMath::Max(MaxMs, Ms);
+	}
+
+	void Merge(const FOVRLipSyncLatencyStats &Other)
+	{
+		if (Other.NumFrames == 0)
+		{
+			return;
+		}
+		NumFrames += Other.NumFrames;
+		AverageMs += (Other.AverageMs - AverageMs) * Other.NumFrames / NumFrames;
+		MaxMs = FMath::Max(MaxMs, Other.MaxMs);
+	}
+};
+
 UENUM()
 enum class OVRLipSyncProviderKind : uint8
 {
@@ -38,13 +77,25 @@ enum class OVRLipSyncProviderKind : uint8
 	EnhancedWithLaughter = 2,
 };
 
+UENUM()
+enum class OVRLipSyncCaptureBackend : uint8
+{
+	// Polls voice module capture on a timer
+	VoiceCapture = 0,
+	// Audio is pushed to the analyser from the capture device callback
+	AudioCapture = 1,
+	// Device is opened once by the shared capture service and read on its own thread
+	SharedDevice = 2,
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class OVRLIPSYNC_API UOVRLipSyncActorComponent : public UOVRLipSyncActorComponentBase
 {
 	GENERATED_BODY()
 
 public:
-	UPROPERTY(EditAnywhere, Category = "LipSync")
+	UPROPERTY(EditAnywhere, Meta = (ToolTip = "Name of the capture device, empty for the system default"),
+			  Category = "LipSync")
 	FString DefaultDeviceName = "";
 
 	UPROPERTY(EditAnywhere, Category = "LipSync")
@@ -59,6 +110,14 @@ public:
 	UPROPERTY(EditAnywhere, Meta = (ToolTip = "Enable hardware acceleration on supported platforms"), Category = "LipSync")
 	bool EnableHardwareAcceleration = true;
 
+	UPROPERTY(EditAnywhere, Meta = (ToolTip = "How microphone audio is delivered to the analyser"), Category = "LipSync")
+	OVRLipSyncCaptureBackend CaptureBackend = OVRLipSyncCaptureBackend::VoiceCapture;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync",
+			  Meta = (ToolTip = "Analyse in a helper process, so SDK crashes and stalls can't take the game down. "
+							   "Falls back to in-process analysis if the helper can't be started."))
+	bool bAnalyzeOutOfProcess = false;
+
 	UFUNCTION(BlueprintCallable, Category = "LipSync")
 	void Start();
 
@@ -72,6 +131,37 @@ public:
 			  Meta = (ToolTip = "Feed AudioBuffer containing packaged mono 16-bit signed integer PCM values"))
 	void FeedAudio(const TArray<uint8> &AudioData);
 
+	// Replaces the voice module capture used by the VoiceCapture backend, e.g. with
+	// FOVRLipSyncFakeVoiceCapture. Takes effect on the next Start, nullptr restores the voice module.
+	void SetVoiceCaptureOverride(TSharedPtr<IVoiceCapture> InVoiceCaptureOverride);
+
+	// Reads pending voice capture audio right away instead of waiting for the capture timer,
+	// so tests running under a virtual clock could drive the component in lockstep
+	void PollVoiceCapture();
+	// Leaves polling the VoiceCapture backend to PollVoiceCapture calls alone, no capture timer is set.
+	// Takes effect on the next Start.
+	void SetPollVoiceCaptureManually(bool bInPollManually);
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Starts recording predictions, memory for MaxDurationSeconds is allocated up front"))
+	void StartRecording(float MaxDurationSeconds = 600.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Stops recording and returns predictions resampled to a sequence at FrameRate"))
+	UOVRLipSyncFrameSequence *StopRecording(float FrameRate = 100.0f);
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	bool IsRecording() const;
+
+	// Latency of analysis since the last Start, comparable between in-process and out-of-process analysis
+	FOVRLipSyncLatencyStats GetLatencyStats() const;
+	// Time spent handling predictions on the thread delivering them, delegates bound to this component included
+	FOVRLipSyncLatencyStats GetCallbackStats() const;
+
+	// False once analysis fell back in process, because the helper couldn't be started or kept running
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	bool IsAnalyzingOutOfProcess() const;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -82,11 +172,64 @@ protected:
 	void OnVoiceCaptureTimer();
 
 private:
+	// Contexts are replaced under ContextLock, as a failed helper is swapped for an in-process context by
+	// the thread submitting audio
+	mutable FCriticalSection ContextLock;
 	TSharedPtr<UOVRLipSyncContextWrapper> LipSyncContext;
+	TUniquePtr<FOVRLipSyncRemoteContext> RemoteContext;
+	// Rate the contexts were created for, which differs from SampleRate when a capture device dictates it
+	int32 ContextSampleRate = 0;
+	// Written by the prediction callback
+	mutable FCriticalSection LatencyLock;
+	FOVRLipSyncLatencyStats LatencyStats;
+	FOVRLipSyncLatencyStats CallbackStats;
 
 	TSharedPtr<IVoiceCapture> VoiceCapture;
+	TSharedPtr<IVoiceCapture> VoiceCaptureOverride;
 	FTimerHandle VoiceCaptureTimer;
+	bool bPollVoiceCaptureManually = false;
 	static const float VoiceCaptureTimerRate;
 
+	TUniquePtr<Audio::FAudioCapture> AudioCapture;
+	// Mono downmix of multichannel capture, only touched from the capture callback
+	TArray<float> AudioCaptureBuffer;
+
+	FDelegateHandle SharedCaptureHandle;
+
+	// Recorder buffer is written by the prediction callback without locks: a writer registers in
+	// NumRecordingWriters, claims a slot by bumping NumClaimedFrames, fills it and publishes it through
+	// NumRecordedFrames. The buffer is only reallocated or moved out once bRecording is off and no writer is
+	// registered, so no write can be in flight.
+	TArray<FOVRLipSyncRecordedFrame> RecordedFrames;
+	TAtomic<int32> NumClaimedFrames{0};
+	TAtomic<int32> NumRecordedFrames{0};
+	TAtomic<int32> NumDroppedFrames{0};
+	TAtomic<int32> NumRecordingWriters{0};
+	TAtomic<bool> bRecording{false};
+	double RecordingStartTime = 0.0;
+
+	// Turns recording off and waits for writers that saw it on to finish
+	void StopRecordingWriters();
+	void RecordFrame(const TArray<float> &NewVisemes, float NewLaughterScore);
+	void OnPrediction(const TArray<float> &NewVisemes, float NewLaughterScore, double SubmitTime);
+
+	bool HasContext() const
+	{
+		FScopeLock Lock(&ContextLock);
+		return LipSyncContext.IsValid() || RemoteContext.IsValid();
+	}
+	// Submits audio to whichever context analyses it, NumSamples counts samples of a single channel
+	void AnalyzeAudio(const int16 *AudioData, int32 NumSamples, bool bStereo = false);
+	void AnalyzeAudio(const float *AudioData, int32 NumSamples, bool bStereo = false);
+
+	void CreateContext(int32 InSampleRate);
+	// Recreates the context unless it exists and runs at InSampleRate
+	void EnsureContext(int32 InSampleRate);
+	void CreateLocalContext(int32 InSampleRate);
+	void FallBackIfHelperFailed();
+	void StartCapture();
 	void StartVoiceCapture();
+	void StartAudioCapture();
+	void StartSharedCapture();
+	void OnAudioCapture(const float *AudioData, int32 NumFrames, int32 NumChannels);
 };
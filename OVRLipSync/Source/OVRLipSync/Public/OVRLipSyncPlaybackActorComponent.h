@@ -26,6 +26,7 @@
 #include "Components/AudioComponent.h"
 #include "OVRLipSyncActorComponentBase.h"
 #include "OVRLipSyncFrame.h"
+#include "OVRLipSyncSequenceBank.h"
 
 #include "OVRLipSyncPlaybackActorComponent.generated.h"
 
@@ -41,6 +42,19 @@ public:
 	UPROPERTY(BlueprintReadonly, Category = "LipSync")
 	UAudioComponent *AudioComponent;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LipSync",
+			  Meta = (Tooltip = "Only update the frame summary, leaving visemes untouched. For low detail faces"))
+	bool bSummaryOnly = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LipSync",
+			  Meta = (Tooltip = "Significance of the speaker, e.g. from the significance manager. Less significant "
+								"speakers play decimated levels of the sequence when it has them"))
+	float Significance = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync",
+			  Meta = (Tooltip = "Significance below the N-th threshold selects decimated level N"))
+	TArray<float> LevelSignificanceThresholds = {0.5f, 0.25f};
+
 	UFUNCTION(BlueprintCallable, Category = "LipSync", Meta = (Tooltip = "Start playback of the canned sequence synchronized with AudioComponent"))
 	void Start(UAudioComponent *InAudioComponent, UOVRLipSyncFrameSequence *InSequence);
 
@@ -50,6 +64,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LipSync", Meta = (Tooltip = "Sets playback sequence property"))
 	void SetPlaybackSequence(UOVRLipSyncFrameSequence *InSequence);
 
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Start playback of a sequence bank line synchronized with AudioComponent"))
+	bool StartFromBank(UAudioComponent *InAudioComponent, UOVRLipSyncSequenceBank *InBank, const FString &LineId);
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Plays a sequence bank line instead of the Sequence property, frames are read from "
+								"the bank in place"))
+	bool SetPlaybackBankLine(UOVRLipSyncSequenceBank *InBank, const FString &LineId);
+
+	// Updates visemes to the frame at PlayPos seconds, for driving playback without an audio component
+	void SetPlaybackTime(float PlayPos);
+
 protected:
 	// Returns audio Component associated with the same
 	UAudioComponent *FindAutoplayAudioComponent() const;
@@ -62,6 +88,14 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	// Bank and frames of the bank line being played, if any
+	UPROPERTY()
+	UOVRLipSyncSequenceBank *Bank;
+	FOVRLipSyncSequenceView BankLine;
+
+	// Returns decimated level to play, or INDEX_NONE for full rate frames
+	int32 SelectLevel() const;
+
 	FDelegateHandle PlaybackPercentHandle;
 	FDelegateHandle PlaybackFinishedHandle;
 };
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncRemoteContext.h
+ * Content     :   Prototypes for OVRLipSync out-of-process live analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "OVRLipSync.h"
+#include "OVRLipSyncSharedRing.h"
+
+class FRunnableThread;
+
+// Runs live analysis in a helper process ("OVRLipSyncCli -Remote"), exchanging audio and frames with it
+// through shared memory rings. A helper that exits or stalls is restarted, audio it left unanalysed and
+// audio submitted while it is down are dropped, so SDK crashes and hangs never reach the game process and
+// no stale frames follow a restart. Once restarts are used up the
+// context reports failure, so the owner could analyse in process instead.
+class OVRLIPSYNC_API FOVRLipSyncRemoteContext : private FRunnable
+{
+public:
+	// Called on the reader thread of the context, SubmitTime is when the analysed audio was submitted
+	using FOnFrame = TFunction<void(const TArray<float> &Visemes, float LaughterScore, double SubmitTime)>;
+
+	FOVRLipSyncRemoteContext(ovrLipSyncContextProvider InProvider, int32 InSampleRate, FOnFrame InOnFrame);
+	virtual ~FOVRLipSyncRemoteContext() override;
+
+	// Creates the rings and launches the helper, returns false if it can't be started, so the caller
+	// could analyse in process instead
+	bool Start();
+
+	// Same contract as UOVRLipSyncContextWrapper::ProcessFrameAsync, called from one thread at a time.
+	// NumSamples counts samples of a single channel.
+	void ProcessFrameAsync(const int16 *AudioBuffer, int32 NumSamples, bool bStereo = false);
+	void ProcessFrameAsync(const float *AudioBuffer, int32 NumSamples, bool bStereo = false);
+
+	// Whether the helper is gone for good, after MaxHelperRestarts or a failed relaunch
+	bool HasFailed() const { return bFailed; }
+	int32 GetNumRestarts() const { return NumRestarts; }
+	int32 GetNumDroppedBuffers() const { return NumDroppedBuffers; }
+
+private:
+	bool LaunchHelper();
+	void StopHelper();
+	// Restarts the helper if it exited or stopped taking audio
+	void CheckHelper(double Now);
+
+	virtual uint32 Run() override;
+	virtual void Stop() override { bStopping = true; }
+
+	ovrLipSyncContextProvider Provider;
+	int32 SampleRate;
+	FOnFrame OnFrame;
+	FString Name;
+
+	FOVRLipSyncSharedRing AudioRing;
+	FOVRLipSyncSharedRing FrameRing;
+	FProcHandle HelperHandle;
+	FRunnableThread *Thread = nullptr;
+	TAtomic<bool> bStopping{false};
+	TAtomic<bool> bHelperRunning{false};
+	TAtomic<bool> bFailed{false};
+
+	// Producer side, only touched by the thread submitting audio
+	uint64 NextSequence = 0;
+	TArray<int16> ConvertedAudio;
+
+	// Reader thread watchdog state
+	uint64 LastAudioReadOffset = 0;
+	double LastProgressTime = 0.0;
+	double LastCheckTime = 0.0;
+	TAtomic<int32> NumRestarts{0};
+	TAtomic<int32> NumDroppedBuffers{0};
+};
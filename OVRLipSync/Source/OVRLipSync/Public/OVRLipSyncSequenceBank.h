@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSequenceBank.h
+ * Content     :   Prototypes for OVRLipSync Sequence Bank
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Async/MappedFileHandle.h"
+#include "CoreMinimal.h"
+#include "OVRLipSyncFrame.h"
+
+#include "OVRLipSyncSequenceBank.generated.h"
+
+// Many sequences packed into a single file, indexed by line ID.
+// The file is either memory mapped or read with a single I/O, frames are read in place.
+UCLASS(BlueprintType)
+class OVRLIPSYNC_API UOVRLipSyncSequenceBank : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Loads sequence bank file, memory mapping it when supported by the platform"))
+	static UOVRLipSyncSequenceBank *LoadBank(const FString &FilePath, bool bMemoryMap = true);
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Writes sequences into a bank file, LineIds and Sequences are matched by index"))
+	static bool SaveBank(const FString &FilePath, const TArray<FString> &LineIds,
+						 const TArray<UOVRLipSyncFrameSequence *> &Sequences);
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	bool Contains(const FString &LineId) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	int32 Num() const;
+
+	// Finds sequence frames of the line, view stays valid while the bank is alive
+	bool FindLine(const FString &LineId, FOVRLipSyncSequenceView &OutView) const;
+
+	virtual void BeginDestroy() override;
+
+private:
+	bool Initialize(const uint8 *InData, int64 InDataSize);
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	// Bank contents when memory mapping is unavailable
+	TArray<uint8> LoadedData;
+
+	const uint8 *Data = nullptr;
+	int64 DataSize = 0;
+};
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncServiceClient.h
+ * Content     :   Prototypes for OVRLipSync generation service client
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "OVRLipSyncFrame.h"
+#include "OVRLipSyncServiceProtocol.h"
+
+class FRunnableThread;
+class FSocket;
+
+// Client of the generation service started with "OVRLipSyncCli -Serve". Requests are pipelined over one
+// connection, so a single client could keep the whole context pool of the service busy.
+class OVRLIPSYNC_API FOVRLipSyncServiceClient : private FRunnable
+{
+public:
+	// Called on the receive thread of the client. bSuccess is false if the service couldn't generate
+	// the sequence or the connection was lost before the response arrived.
+	using FOnGenerated = TFunction<void(bool bSuccess, FOVRLipSyncFrameData &&Frames, float FrameRate)>;
+
+	virtual ~FOVRLipSyncServiceClient() override;
+
+	bool Connect(const FString &Host = TEXT("127.0.0.1"), int32 Port = FOVRLipSyncServiceProtocol::DefaultPort);
+
+	// Closes the connection, callbacks of requests in flight are called with bSuccess false
+	void Disconnect();
+
+	bool IsConnected() const { return bConnected; }
+
+	// Requests sequence for interleaved 16-bit samples, returns false if the request couldn't be sent, in which
+	// case OnGenerated isn't called
+	bool GenerateFromPCM(TArrayView<const int16> PCMData, int32 SampleRate, int32 NumChannels,
+						 FOnGenerated OnGenerated);
+
+	// Requests sequence for a complete 16-bit PCM WAV file
+	bool GenerateFromWav(TArrayView<const uint8> WavData, FOnGenerated OnGenerated);
+
+	int32 GetNumPending() const;
+
+private:
+	bool SendRequest(FOVRLipSyncServiceRequest &Request, const void *Payload, FOnGenerated &&OnGenerated);
+	void FailPending();
+
+	virtual uint32 Run() override;
+
+	FSocket *Socket = nullptr;
+	FRunnableThread *Thread = nullptr;
+	TAtomic<bool> bConnected{false};
+
+	// Serializes requests on the socket. Sends block while the service applies backpressure, so it is never
+	// needed by the receive thread.
+	FCriticalSection SendLock;
+	// Guards pending requests only, never held across socket I/O
+	mutable FCriticalSection PendingLock;
+	TMap<uint32, FOnGenerated> Pending;
+	uint32 NextRequestId = 1;
+};
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSettings.h
+ * Content     :   Prototypes for OVRLipSync project settings
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "OVRLipSyncFrame.h"
+
+#include "OVRLipSyncSettings.generated.h"
+
+// How sequences are stored in cooked packages. Sequences are decoded on load, so these only trade
+// package size and load time against accuracy.
+USTRUCT()
+struct OVRLIPSYNC_API FOVRLipSyncCookSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "LipSync")
+	OVRLipSyncSequenceEncoding Encoding = OVRLipSyncSequenceEncoding::Float;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync",
+			  Meta = (EditCondition = "Encoding == OVRLipSyncSequenceEncoding::Keyframed", ClampMin = "0",
+					  ClampMax = "0.2", Tooltip = "Largest score error interpolation between keys may introduce"))
+	float KeyframeTolerance = 0.02f;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync",
+			  Meta = (ClampMin = "0", ClampMax = "4", Tooltip = "Each step halves the frame rate of cooked sequences"))
+	int32 FrameRateReduction = 0;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync",
+			  Meta = (Tooltip = "Drops laughter scores for projects that don't use them, they read as zero"))
+	bool bStripLaughter = false;
+
+	bool IsLossless() const
+	{
+		return Encoding == OVRLipSyncSequenceEncoding::Float && FrameRateReduction == 0 && !bStripLaughter;
+	}
+};
+
+UCLASS(Config = Game, DefaultConfig, Meta = (DisplayName = "OVR LipSync"))
+class OVRLIPSYNC_API UOVRLipSyncSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UOVRLipSyncSettings();
+
+	UPROPERTY(Config, EditAnywhere, Category = "Cooking")
+	FOVRLipSyncCookSettings DefaultCookSettings;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Cooking",
+			  Meta = (Tooltip = "Overrides keyed by platform name as used by config files, e.g. Windows or Android"))
+	TMap<FString, FOVRLipSyncCookSettings> PlatformCookSettings;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Live",
+			  Meta = (Tooltip = "OVRLipSyncCli used for out-of-process analysis, relative to the project directory. "
+							   "Empty looks for it in the binaries of the plugin."))
+	FString HelperExecutable;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Live",
+			  Meta = (ClampMin = "0.1", Tooltip = "Helper is restarted when it doesn't take queued audio for this long"))
+	float HelperStallTimeoutSeconds = 2.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Live",
+			  Meta = (ClampMin = "0", Tooltip = "Restarts after which a failing helper is given up on"))
+	int32 MaxHelperRestarts = 3;
+
+	// Cook settings of the platform, DefaultCookSettings unless it is overridden
+	static const FOVRLipSyncCookSettings &GetCookSettings(const FString &PlatformName);
+
+	// Absolute path of the helper executable
+	FString GetHelperExecutablePath() const;
+
+	// Directory of the plugin, wherever it is installed: in the project, the engine or the Marketplace folder
+	static FString GetPluginDir();
+
+	// Absolute path of the directory the SDK library is loaded from on this platform
+	static FString GetLibraryDir();
+};
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncStressHarness.h
+ * Content     :   Prototypes for OVRLipSync speaker count stress harness
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "OVRLipSyncStressHarness.generated.h"
+
+class FOVRLipSyncFakeVoiceCapture;
+class UOVRLipSyncActorComponent;
+class UOVRLipSyncActorComponentBase;
+class UOVRLipSyncFrameSequence;
+class UOVRLipSyncPlaybackActorComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOVRLipSyncStressFinishedDelegate, bool, bPassed);
+
+// Spawns the configured number of live and playback speakers fed with synthetic audio, measures their
+// per component cost and checks it against thresholds. Drop it into a map and run it with -csvCaptureFrames
+// to get the CSV breakdown, or bind OnStressFinished from a functional test to fail it on regressions.
+UCLASS(ClassGroup = (Custom))
+class OVRLIPSYNC_API AOVRLipSyncStressHarness : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AOVRLipSyncStressHarness();
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress")
+	int32 NumLiveSpeakers = 8;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress")
+	int32 NumPlaybackSpeakers = 32;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress", Meta = (Tooltip = "Frames skipped before measuring"))
+	int32 WarmupFrames = 60;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress")
+	int32 MeasuredFrames = 600;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress",
+			  Meta = (Tooltip = "Fails when average game thread cost of a live speaker exceeds this"))
+	float MaxLiveGameThreadUs = 50.0f;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress",
+			  Meta = (Tooltip = "Fails when average game thread cost of a playback speaker exceeds this"))
+	float MaxPlaybackGameThreadUs = 10.0f;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress",
+			  Meta = (Tooltip = "Fails when inference falls behind by more than this many buffers per live speaker"))
+	int32 MaxPendingResultsPerSpeaker = 4;
+
+	UPROPERTY(EditAnywhere, Category = "LipSync|Stress",
+			  Meta = (Tooltip = "Exits with non-zero code when thresholds are exceeded, for headless runs"))
+	bool bQuitWhenFinished = false;
+
+	UPROPERTY(BlueprintAssignable, Category = "LipSync|Stress")
+	FOVRLipSyncStressFinishedDelegate OnStressFinished;
+
+	virtual void Tick(float DeltaSeconds) override;
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	void OnLiveVisemesReady(const UOVRLipSyncActorComponentBase *Speaker);
+
+	void Finish();
+
+	UPROPERTY(Transient)
+	TArray<UOVRLipSyncActorComponent *> LiveSpeakers;
+	UPROPERTY(Transient)
+	TArray<UOVRLipSyncPlaybackActorComponent *> PlaybackSpeakers;
+	UPROPERTY(Transient)
+	UOVRLipSyncFrameSequence *PlaybackSequence;
+
+	TArray<TSharedPtr<FOVRLipSyncFakeVoiceCapture>> LiveCaptures;
+
+	int32 FrameCounter = 0;
+	float PlaybackTime = 0.0f;
+	uint64 LiveCycles = 0;
+	uint64 PlaybackCycles = 0;
+	int64 NumFeeds = 0;
+	TAtomic<int64> NumResults{0};
+	int64 MaxPendingResults = 0;
+	bool bFinished = false;
+};
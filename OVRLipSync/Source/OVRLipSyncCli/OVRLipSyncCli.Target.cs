@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncCli.Target.cs
+ * Content     :   Unreal build target for OVRLipSyncCli
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+using UnrealBuildTool;
+
+// Console program generating sequence banks from WAV files, built without the engine
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class OVRLipSyncCliTarget : TargetRules
+{
+    public OVRLipSyncCliTarget(TargetInfo Target) : base(Target)
+    {
+        Type = TargetType.Program;
+        LinkType = TargetLinkType.Monolithic;
+        LaunchModuleName = "OVRLipSyncCli";
+        DefaultBuildSettings = BuildSettingsVersion.Latest;
+        IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+
+        bBuildDeveloperTools = false;
+        bCompileAgainstEngine = false;
+        bCompileAgainstCoreUObject = false;
+        bCompileAgainstApplicationCore = false;
+        bCompileICU = false;
+        bUseLoggingInShipping = true;
+        bIsBuildingConsoleApplication = true;
+
+        // Only OVRLipSyncCore of the plugin is built for programs
+        EnablePlugins.Add("OVRLipSync");
+    }
+}
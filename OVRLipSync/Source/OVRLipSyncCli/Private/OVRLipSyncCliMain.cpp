@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncCliMain.cpp
+ * Content     :   Command line sequence bank generator
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "RequiredProgramMainCPPInclude.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncBankFormat.h"
+#include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncRemoteHelper.h"
+#include "OVRLipSyncService.h"
+#include "OVRLipSyncWav.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOvrLipSyncCli, Log, All);
+
+IMPLEMENT_APPLICATION(OVRLipSyncCli, "OVRLipSyncCli");
+
+namespace
+{
+const TCHAR *Usage = TEXT("Usage: OVRLipSyncCli -Input=<WAV file or directory> -Output=<bank file> [-Repeat=1]\n")
+					 TEXT("       OVRLipSyncCli -Serve [-Port=7797] [-Contexts=4] [-MaxBatch=8] [-MaxQueued=64]\n")
+					 TEXT("             [-WarmContexts=4]\n")
+					 TEXT("       OVRLipSyncCli -Remote=<ring name> [-Provider=1] [-ParentPID=<pid>]\n")
+					 TEXT("Options: [-Analyzer=Context|Energy] [-LibDir=<SDK library directory>] [-HopMs=10]");
+
+struct FCliLine
+{
+	FString LineId;
+	TArray<float> Visemes;
+	TArray<float> LaughterScores;
+	float FrameRate = 100.0f;
+};
+
+int32 Serve(const TCHAR *CommandLine, const FString &AnalyzerName, const FOVRLipSyncAnalysisSettings &Settings)
+{
+	FOVRLipSyncServiceSettings ServiceSettings;
+	ServiceSettings.AnalyzerName = AnalyzerName;
+	ServiceSettings.AnalysisSettings = Settings;
+	FParse::Value(CommandLine, TEXT("-Port="), ServiceSettings.Port);
+	FParse::Value(CommandLine, TEXT("-Contexts="), ServiceSettings.NumContexts);
+	FParse::Value(CommandLine, TEXT("-MaxBatch="), ServiceSettings.MaxBatchSize);
+	FParse::Value(CommandLine, TEXT("-MaxQueued="), ServiceSettings.MaxQueuedRequests);
+	FParse::Value(CommandLine, TEXT("-WarmContexts="), ServiceSettings.MaxWarmContexts);
+	FOVRLipSyncService Service(ServiceSettings);
+	return Service.Run() ? 0 : 1;
+}
+
+int32 RunRemote(const TCHAR *CommandLine, const FString &Name, const FString &AnalyzerName)
+{
+	FOVRLipSyncRemoteHelperSettings HelperSettings;
+	HelperSettings.Name = Name;
+	HelperSettings.AnalyzerName = AnalyzerName;
+	int32 Provider = HelperSettings.Provider;
+	FParse::Value(CommandLine, TEXT("-Provider="), Provider);
+	HelperSettings.Provider = static_cast<ovrLipSyncContextProvider>(Provider);
+	FParse::Value(CommandLine, TEXT("-ParentPID="), HelperSettings.ParentProcessId);
+	return RunOVRLipSyncRemoteHelper(HelperSettings) ? 0 : 1;
+}
+
+int32 Generate(const TCHAR *CommandLine, const FString &AnalyzerName, FOVRLipSyncAnalysisSettings Settings)
+{
+	FString Input, Output;
+	if (!FParse::Value(CommandLine, TEXT("-Input="), Input) || !FParse::Value(CommandLine, TEXT("-Output="), Output))
+	{
+		UE_LOG(LogOvrLipSyncCli, Display, TEXT("%s"), Usage);
+		return 1;
+	}
+	int32 NumRepeats = 1;
+	FParse::Value(CommandLine, TEXT("-Repeat="), NumRepeats);
+	NumRepeats = FMath::Max(NumRepeats, 1);
+
+	TArray<FString> Files;
+	// Lines of a directory are identified by their path relative to it, so equally named files of different
+	// subdirectories stay apart
+	FString InputRoot;
+	if (IFileManager::Get().DirectoryExists(*Input))
+	{
+		IFileManager::Get().FindFilesRecursive(Files, *Input, TEXT("*.wav"), true, false);
+		Files.Sort();
+		InputRoot = Input;
+		FPaths::NormalizeDirectoryName(InputRoot);
+		InputRoot /= TEXT("");
+	}
+	else
+	{
+		Files.Add(Input);
+	}
+
+	TMap<int32, TUniquePtr<IOVRLipSyncAnalyzer>> Analyzers;
+	TArray<FCliLine> Lines;
+	Lines.Reserve(Files.Num());
+	TArray<int16> PCMData;
+	double AudioSeconds = 0.0, AnalysisSeconds = 0.0;
+	for (const auto &File : Files)
+	{
+		FOVRLipSyncWavInfo Info;
+		if (!FOVRLipSyncWav::LoadFile(File, PCMData, Info))
+		{
+			return 1;
+		}
+		if (Info.SampleRate == 0 || Info.NumChannels < 1 || Info.NumChannels > 2)
+		{
+			UE_LOG(LogOvrLipSyncCli, Error, TEXT("%s: unsupported format, %u Hz with %u channels"), *File,
+				   Info.SampleRate, Info.NumChannels);
+			return 1;
+		}
+		auto &Analyzer = Analyzers.FindOrAdd(Info.SampleRate);
+		if (!Analyzer)
+		{
+			Analyzer = IOVRLipSyncAnalyzer::Create(AnalyzerName, Info.SampleRate);
+			if (!Analyzer)
+			{
+				return 1;
+			}
+		}
+		Settings.SampleRate = Info.SampleRate;
+		Settings.NumChannels = Info.NumChannels;
+		FOVRLipSyncChunkedAnalysis Analysis(*Analyzer, Settings);
+
+		auto &Line = Lines.AddDefaulted_GetRef();
+		Line.LineId = FPaths::GetBaseFilename(File, InputRoot.IsEmpty());
+		if (!InputRoot.IsEmpty())
+		{
+			FPaths::NormalizeFilename(Line.LineId);
+			FPaths::MakePathRelativeTo(Line.LineId, *InputRoot);
+		}
+		Line.FrameRate = Analysis.GetFrameRate();
+		const auto StartTime = FPlatformTime::Seconds();
+		for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+		{
+			Line.Visemes.Reset();
+			Line.LaughterScores.Reset();
+			Analysis.Generate(PCMData.GetData(), PCMData.Num(), Line.Visemes, Line.LaughterScores,
+							  [](float) { return true; });
+		}
+		AnalysisSeconds += FPlatformTime::Seconds() - StartTime;
+		AudioSeconds += static_cast<double>(PCMData.Num()) * NumRepeats / (Info.SampleRate * Info.NumChannels);
+		UE_LOG(LogOvrLipSyncCli, Display, TEXT("%s: %d frames"), *Line.LineId, Line.LaughterScores.Num());
+	}
+	Analyzers.Empty();
+
+	TArray<FOVRLipSyncBankLine> BankLines;
+	BankLines.Reserve(Lines.Num());
+	for (const auto &Line : Lines)
+	{
+		BankLines.Add({Line.LineId, Line.Visemes, Line.LaughterScores, Line.FrameRate});
+	}
+	TArray<uint8> Bytes;
+	if (!FOVRLipSyncBankFormat::Write(BankLines, Bytes))
+	{
+		return 1;
+	}
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Output))
+	{
+		UE_LOG(LogOvrLipSyncCli, Error, TEXT("Can't write sequence bank %s"), *Output);
+		return 1;
+	}
+	UE_LOG(LogOvrLipSyncCli, Display,
+		   TEXT("%d files, %.1f s of audio analysed in %.2f s with %s analyzer (%.1fx realtime), bank written to %s"),
+		   Lines.Num(), AudioSeconds, AnalysisSeconds, *AnalyzerName,
+		   AnalysisSeconds > 0.0 ? AudioSeconds / AnalysisSeconds : 0.0, *Output);
+	return 0;
+}
+
+int32 Run(const TCHAR *CommandLine)
+{
+	FString AnalyzerName = IOVRLipSyncAnalyzer::GetDefaultName();
+	FParse::Value(CommandLine, TEXT("-Analyzer="), AnalyzerName);
+	FString LibDir;
+	if (FParse::Value(CommandLine, TEXT("-LibDir="), LibDir))
+	{
+#if WITH_OVRLIPSYNC_SDK
+		UOVRLipSyncContextWrapper::SetLibraryDirectory(LibDir);
+#endif
+	}
+	FOVRLipSyncAnalysisSettings Settings;
+	FParse::Value(CommandLine, TEXT("-HopMs="), Settings.HopMs);
+	Settings.WindowMs = Settings.HopMs;
+	FString RemoteName;
+	if (FParse::Value(CommandLine, TEXT("-Remote="), RemoteName))
+	{
+		return RunRemote(CommandLine, RemoteName, AnalyzerName);
+	}
+	return FParse::Param(CommandLine, TEXT("Serve")) ? Serve(CommandLine, AnalyzerName, Settings)
+													 : Generate(CommandLine, AnalyzerName, Settings);
+}
+} // namespace
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	ON_SCOPE_EXIT
+	{
+		FEngineLoop::AppPreExit();
+		FEngineLoop::AppExit();
+	};
+
+	if (GEngineLoop.PreInit(ArgC, ArgV) != 0)
+	{
+		return 1;
+	}
+	auto Result = Run(FCommandLine::Get());
+#if WITH_OVRLIPSYNC_SDK
+	ovrLipSync_Shutdown();
+#endif
+	return Result;
+}
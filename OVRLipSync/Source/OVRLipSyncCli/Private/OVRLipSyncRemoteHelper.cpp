@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncRemoteHelper.cpp
+ * Content     :   OVRLipSync out-of-process live analysis helper
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncRemoteHelper.h"
+
+#include "HAL/PlatformProcess.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncRemoteProtocol.h"
+#include "OVRLipSyncSharedRing.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOvrLipSyncRemote, Log, All);
+
+namespace
+{
+// Time the helper sleeps when there is no audio, well below the 10ms cadence audio arrives at
+constexpr float PollIntervalSeconds = 0.0005f;
+constexpr double ParentCheckIntervalSeconds = 1.0;
+} // namespace
+
+bool RunOVRLipSyncRemoteHelper(const FOVRLipSyncRemoteHelperSettings &Settings)
+{
+	FOVRLipSyncSharedRing AudioRing, FrameRing;
+	if (!AudioRing.Open(FOVRLipSyncRemoteProtocol::GetAudioRingName(Settings.Name)) ||
+		!FrameRing.Open(FOVRLipSyncRemoteProtocol::GetFrameRingName(Settings.Name)))
+	{
+		return false;
+	}
+	UE_LOG(LogOvrLipSyncRemote, Display, TEXT("Analysing %s with %s analyzer"), *Settings.Name,
+		   *Settings.AnalyzerName);
+
+	// Contexts are bound to a sample rate, the game recreates its context when the device rate changes
+	TMap<uint32, TUniquePtr<IOVRLipSyncAnalyzer>> Analyzers;
+	TArray<uint8> Record;
+	FOVRLipSyncRemoteAudio Audio;
+	FOVRLipSyncRemoteFrame Frame;
+	uint64 NumFrames = 0, NumDroppedFrames = 0;
+	auto LastParentCheckTime = FPlatformTime::Seconds();
+	while (!AudioRing.IsClosed() && !IsEngineExitRequested())
+	{
+		if (!AudioRing.Read(Record))
+		{
+			const auto Now = FPlatformTime::Seconds();
+			if (Now - LastParentCheckTime >= ParentCheckIntervalSeconds)
+			{
+				LastParentCheckTime = Now;
+				if (Settings.ParentProcessId != 0 && !FPlatformProcess::IsApplicationRunning(Settings.ParentProcessId))
+				{
+					UE_LOG(LogOvrLipSyncRemote, Display, TEXT("Game process exited"));
+					break;
+				}
+			}
+			FPlatformProcess::Sleep(PollIntervalSeconds);
+			continue;
+		}
+		if (Record.Num() < static_cast<int32>(sizeof(Audio)))
+		{
+			continue;
+		}
+		FMemory::Memcpy(&Audio, Record.GetData(), sizeof(Audio));
+		if (Audio.SampleRate == 0 || Audio.NumChannels < 1 || Audio.NumChannels > 2)
+		{
+			continue;
+		}
+
+		const auto StartTime = FPlatformTime::Seconds();
+		auto &Analyzer = Analyzers.FindOrAdd(Audio.SampleRate);
+		if (!Analyzer)
+		{
+			Analyzer = IOVRLipSyncAnalyzer::Create(Settings.AnalyzerName, Audio.SampleRate, Settings.Provider);
+			if (!Analyzer)
+			{
+				return false;
+			}
+		}
+		const auto NumSamples =
+			static_cast<int32>((Record.Num() - sizeof(Audio)) / (sizeof(int16) * Audio.NumChannels));
+		Frame.Sequence = Audio.Sequence;
+		Frame.SubmitTime = Audio.SubmitTime;
+		Analyzer->Analyze(reinterpret_cast<const int16 *>(Record.GetData() + sizeof(Audio)), NumSamples,
+						  Audio.NumChannels == 2, Frame.Visemes, Frame.LaughterScore, Frame.FrameDelayMs);
+		Frame.AnalysisMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		// The game reads frames as they come, a full ring means it stopped reading
+		++NumFrames;
+		if (!FrameRing.Write(&Frame, sizeof(Frame)))
+		{
+			++NumDroppedFrames;
+		}
+	}
+	UE_LOG(LogOvrLipSyncRemote, Display, TEXT("Analysed %llu buffers, %llu frames dropped"), NumFrames,
+		   NumDroppedFrames);
+	return true;
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncRemoteHelper.h
+ * Content     :   Prototypes for OVRLipSync out-of-process live analysis helper
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OVRLipSync.h"
+
+struct FOVRLipSyncRemoteHelperSettings
+{
+	// Base name of the rings created by the game
+	FString Name;
+	FString AnalyzerName;
+	ovrLipSyncContextProvider Provider = ovrLipSyncContextProvider_Enhanced;
+	// Helper exits once this process is gone, 0 disables the check
+	uint32 ParentProcessId = 0;
+};
+
+// Analyses audio the game writes to the audio ring and writes frames back to the frame ring, until the game
+// closes the rings or exits. Returns false if the rings can't be opened.
+bool RunOVRLipSyncRemoteHelper(const FOVRLipSyncRemoteHelperSettings &Settings);
@@ -0,0 +1,520 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncService.cpp
+ * Content     :   OVRLipSync generation service
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncService.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "OVRLipSyncFrameCodec.h"
+#include "OVRLipSyncWav.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOvrLipSyncService, Log, All);
+
+namespace
+{
+// Time the accept loop waits for connections before checking for exit and reporting metrics
+constexpr float AcceptTimeoutSeconds = 0.1f;
+// Number of latest requests latency percentiles are computed from
+constexpr int32 MaxLatencySamples = 4096;
+
+bool RecvAll(FSocket &Socket, uint8 *Data, int32 Size)
+{
+	while (Size > 0)
+	{
+		int32 BytesRead = 0;
+		if (!Socket.Recv(Data, Size, BytesRead) || BytesRead <= 0)
+		{
+			return false;
+		}
+		Data += BytesRead;
+		Size -= BytesRead;
+	}
+	return true;
+}
+
+bool SendAll(FSocket &Socket, const uint8 *Data, int32 Size)
+{
+	while (Size > 0)
+	{
+		int32 BytesSent = 0;
+		if (!Socket.Send(Data, Size, BytesSent) || BytesSent <= 0)
+		{
+			return false;
+		}
+		Data += BytesSent;
+		Size -= BytesSent;
+	}
+	return true;
+}
+
+void AddLatencySample(TArray<float> &Samples, float Ms)
+{
+	if (Samples.Num() >= MaxLatencySamples)
+	{
+		Samples.RemoveAt(0, Samples.Num() - MaxLatencySamples + 1);
+	}
+	Samples.Add(Ms);
+}
+
+float GetPercentile(TArray<float> &Samples, float Percentile)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+	Samples.Sort();
+	return Samples[FMath::Min(Samples.Num() - 1, FMath::FloorToInt(Samples.Num() * Percentile))];
+}
+} // namespace
+
+// Reads requests of one client on its own thread, responses are sent by workers
+class FOVRLipSyncService::FConnection : public FRunnable, public TSharedFromThis<FConnection>
+{
+public:
+	FConnection(FOVRLipSyncService &InService, FSocket *InSocket) : Service(InService), Socket(InSocket) {}
+
+	virtual ~FConnection()
+	{
+		Close();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+
+	void Start() { Thread = FRunnableThread::Create(this, TEXT("OVRLipSyncConnection")); }
+
+	// Unblocks the reading thread, requests in flight are answered into the void
+	void Close() { Socket->Shutdown(ESocketShutdownMode::ReadWrite); }
+
+	bool IsFinished() const { return bFinished; }
+
+	bool Send(const FOVRLipSyncServiceResponse &Response, TArrayView<const uint8> Payload)
+	{
+		FScopeLock Lock(&SendLock);
+		return SendAll(*Socket, reinterpret_cast<const uint8 *>(&Response), sizeof(Response)) &&
+			   SendAll(*Socket, Payload.GetData(), Payload.Num());
+	}
+
+	virtual uint32 Run() override
+	{
+		while (ReadRequest())
+		{
+		}
+		bFinished = true;
+		return 0;
+	}
+
+private:
+	// Reads and enqueues a request, returns false once the connection can't be used anymore
+	bool ReadRequest()
+	{
+		FOVRLipSyncServiceRequest Header;
+		if (!RecvAll(*Socket, reinterpret_cast<uint8 *>(&Header), sizeof(Header)))
+		{
+			return false;
+		}
+		if (Header.Magic != FOVRLipSyncServiceProtocol::RequestMagic ||
+			Header.PayloadSize > FOVRLipSyncServiceProtocol::MaxPayloadSize)
+		{
+			UE_LOG(LogOvrLipSyncService, Warning, TEXT("Closing connection after malformed request"));
+			return false;
+		}
+		Payload.SetNumUninitialized(Header.PayloadSize);
+		if (!RecvAll(*Socket, Payload.GetData(), Payload.Num()))
+		{
+			return false;
+		}
+
+		FPendingRequest Request;
+		Request.Connection = AsShared();
+		Request.RequestId = Header.RequestId;
+		Request.ReceivedTime = FPlatformTime::Seconds();
+		const uint8 *PCMData = Payload.GetData();
+		int64 PCMDataSize = Payload.Num();
+		if (Header.PayloadType == FOVRLipSyncServiceProtocol::Payload::Wav)
+		{
+			FOVRLipSyncWavInfo Info;
+			if (!FOVRLipSyncWav::ParseHeader(Payload, Info))
+			{
+				return Reject(Header.RequestId);
+			}
+			Request.SampleRate = Info.SampleRate;
+			Request.NumChannels = Info.NumChannels;
+			PCMData += Info.PCMDataOffset;
+			PCMDataSize = FMath::Min<int64>(Info.PCMDataSize, Payload.Num() - Info.PCMDataOffset);
+		}
+		else
+		{
+			Request.SampleRate = Header.SampleRate;
+			Request.NumChannels = Header.NumChannels;
+		}
+		if (Request.SampleRate <= 0 || Request.NumChannels < 1 || Request.NumChannels > 2)
+		{
+			return Reject(Header.RequestId);
+		}
+		Request.PCMData.SetNumUninitialized(PCMDataSize / sizeof(int16));
+		FMemory::Memcpy(Request.PCMData.GetData(), PCMData, Request.PCMData.Num() * sizeof(int16));
+		return Service.Enqueue(MoveTemp(Request));
+	}
+
+	bool Reject(uint32 RequestId)
+	{
+		FOVRLipSyncServiceResponse Response;
+		Response.RequestId = RequestId;
+		Response.Status = FOVRLipSyncServiceProtocol::Status::InvalidRequest;
+		Service.RecordRequest(0.0, 0.0, 0.0, false);
+		return Send(Response, {});
+	}
+
+	FOVRLipSyncService &Service;
+	FSocket *Socket;
+	FRunnableThread *Thread = nullptr;
+	TAtomic<bool> bFinished{false};
+	FCriticalSection SendLock;
+	// Reused between requests of the connection
+	TArray<uint8> Payload;
+};
+
+// Processes batches of requests, keeping an analyzer per audio format between them
+class FOVRLipSyncService::FWorker : public FRunnable
+{
+public:
+	FWorker(FOVRLipSyncService &InService, int32 Index) : Service(InService)
+	{
+		Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("OVRLipSyncWorker %d"), Index));
+	}
+
+	virtual ~FWorker()
+	{
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+	}
+
+	virtual uint32 Run() override
+	{
+		TArray<FPendingRequest> Batch;
+		while (Service.DequeueBatch(Batch))
+		{
+			const auto StartTime = FPlatformTime::Seconds();
+			for (auto &Request : Batch)
+			{
+				Process(Request);
+			}
+			Service.RecordBatch(Batch.Num(), FPlatformTime::Seconds() - StartTime);
+			Batch.Reset();
+		}
+		return 0;
+	}
+
+private:
+	struct FWarmContext
+	{
+		TUniquePtr<IOVRLipSyncAnalyzer> Analyzer;
+		TUniquePtr<FOVRLipSyncChunkedAnalysis> Analysis;
+		uint64 LastUse = 0;
+	};
+
+	FOVRLipSyncChunkedAnalysis *GetAnalysis(int32 SampleRate, int32 NumChannels)
+	{
+		const TPair<int32, int32> Key(SampleRate, NumChannels);
+		// Clients pick the sample rate, so the contexts kept are bounded by evicting the least recently used
+		if (!Contexts.Contains(Key) && Contexts.Num() >= Service.Settings.MaxWarmContexts)
+		{
+			auto Oldest = Contexts.CreateIterator();
+			for (auto It = Contexts.CreateIterator(); It; ++It)
+			{
+				if (It.Value().LastUse < Oldest.Value().LastUse)
+				{
+					Oldest = It;
+				}
+			}
+			Oldest.RemoveCurrent();
+		}
+		auto &Context = Contexts.FindOrAdd(Key);
+		Context.LastUse = ++NumUses;
+		if (!Context.Analyzer)
+		{
+			FScopeLock Lock(&Service.AnalyzerLock);
+			Context.Analyzer = IOVRLipSyncAnalyzer::Create(Service.Settings.AnalyzerName, SampleRate);
+			if (!Context.Analyzer)
+			{
+				Contexts.Remove(Key);
+				return nullptr;
+			}
+			auto AnalysisSettings = Service.Settings.AnalysisSettings;
+			AnalysisSettings.SampleRate = SampleRate;
+			AnalysisSettings.NumChannels = NumChannels;
+			Context.Analysis = MakeUnique<FOVRLipSyncChunkedAnalysis>(*Context.Analyzer, AnalysisSettings);
+		}
+		return Context.Analysis.Get();
+	}
+
+	void Process(FPendingRequest &Request)
+	{
+		const auto StartTime = FPlatformTime::Seconds();
+		FOVRLipSyncServiceResponse Response;
+		Response.RequestId = Request.RequestId;
+		Payload.Reset();
+		auto Analysis = GetAnalysis(Request.SampleRate, Request.NumChannels);
+		if (Analysis)
+		{
+			Visemes.Reset();
+			LaughterScores.Reset();
+			Analysis->Generate(Request.PCMData.GetData(), Request.PCMData.Num(), Visemes, LaughterScores,
+							   [](float) { return true; });
+			Response.NumFrames = LaughterScores.Num();
+			Response.FrameRate = Analysis->GetFrameRate();
+			Payload.Reserve(Visemes.Num() + LaughterScores.Num());
+			for (auto Score : Visemes)
+			{
+				Payload.Add(FOVRLipSyncFrameCodec::Quantize(Score));
+			}
+			for (auto Score : LaughterScores)
+			{
+				Payload.Add(FOVRLipSyncFrameCodec::Quantize(Score));
+			}
+		}
+		else
+		{
+			Response.Status = FOVRLipSyncServiceProtocol::Status::AnalysisFailed;
+		}
+		Response.PayloadSize = Payload.Num();
+		Request.Connection->Send(Response, Payload);
+
+		const auto EndTime = FPlatformTime::Seconds();
+		const auto AudioSeconds =
+			static_cast<double>(Request.PCMData.Num()) / (Request.SampleRate * Request.NumChannels);
+		Service.RecordRequest(StartTime - Request.ReceivedTime, EndTime - Request.ReceivedTime, AudioSeconds,
+							  Analysis != nullptr);
+	}
+
+	FOVRLipSyncService &Service;
+	FRunnableThread *Thread = nullptr;
+	TMap<TPair<int32, int32>, FWarmContext> Contexts;
+	uint64 NumUses = 0;
+	// Reused between requests
+	TArray<float> Visemes;
+	TArray<float> LaughterScores;
+	TArray<uint8> Payload;
+};
+
+FOVRLipSyncService::FOVRLipSyncService(const FOVRLipSyncServiceSettings &InSettings) : Settings(InSettings)
+{
+	Settings.NumContexts = FMath::Max(Settings.NumContexts, 1);
+	Settings.MaxBatchSize = FMath::Max(Settings.MaxBatchSize, 1);
+	Settings.MaxQueuedRequests = FMath::Max(Settings.MaxQueuedRequests, 1);
+	Settings.MaxWarmContexts = FMath::Max(Settings.MaxWarmContexts, 1);
+	QueueEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	QueueSpaceEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FOVRLipSyncService::~FOVRLipSyncService()
+{
+	bStopping = true;
+	for (auto &Connection : Connections)
+	{
+		Connection->Close();
+	}
+	for (int32 Idx = 0; Idx < Workers.Num(); ++Idx)
+	{
+		QueueEvent->Trigger();
+	}
+	for (int32 Idx = 0; Idx < Connections.Num(); ++Idx)
+	{
+		QueueSpaceEvent->Trigger();
+	}
+	Workers.Empty();
+	Queue.Empty();
+	Connections.Empty();
+	if (ListenSocket)
+	{
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+	}
+	FPlatformProcess::ReturnSynchEventToPool(QueueEvent);
+	FPlatformProcess::ReturnSynchEventToPool(QueueSpaceEvent);
+}
+
+bool FOVRLipSyncService::Run()
+{
+	auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	auto Address = SocketSubsystem->CreateInternetAddr();
+	// Only local clients are served
+	Address->SetLoopbackAddress();
+	Address->SetPort(Settings.Port);
+	ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("OVRLipSyncService"), Address->GetProtocolType());
+	if (!ListenSocket || !ListenSocket->Bind(*Address) || !ListenSocket->Listen(16))
+	{
+		UE_LOG(LogOvrLipSyncService, Error, TEXT("Can't listen on port %d"), Settings.Port);
+		return false;
+	}
+	for (int32 Idx = 0; Idx < Settings.NumContexts; ++Idx)
+	{
+		Workers.Add(MakeUnique<FWorker>(*this, Idx));
+	}
+	UE_LOG(LogOvrLipSyncService, Display, TEXT("Serving on %s with %d %s contexts, batches of up to %d requests"),
+		   *Address->ToString(true), Settings.NumContexts, *Settings.AnalyzerName, Settings.MaxBatchSize);
+
+	LastReportTime = FPlatformTime::Seconds();
+	while (!IsEngineExitRequested())
+	{
+		bool bHasPendingConnection = false;
+		ListenSocket->WaitForPendingConnection(bHasPendingConnection, FTimespan::FromSeconds(AcceptTimeoutSeconds));
+		if (bHasPendingConnection)
+		{
+			if (auto Socket = ListenSocket->Accept(TEXT("OVRLipSyncClient")))
+			{
+				Socket->SetNoDelay(true);
+				auto Connection = MakeShared<FConnection>(*this, Socket);
+				Connection->Start();
+				Connections.Add(Connection);
+			}
+		}
+		Connections.RemoveAll([](const TSharedPtr<FConnection> &Connection) { return Connection->IsFinished(); });
+
+		if (FPlatformTime::Seconds() - LastReportTime >= Settings.ReportIntervalSeconds)
+		{
+			ReportMetrics();
+		}
+	}
+	return true;
+}
+
+bool FOVRLipSyncService::Enqueue(FPendingRequest &&Request)
+{
+	const int64 RequestBytes = Request.PCMData.Num() * sizeof(int16);
+	while (!bStopping)
+	{
+		{
+			FScopeLock Lock(&QueueLock);
+			// A request larger than the byte limit is still taken once the queue drained
+			if (Queue.Num() == 0 ||
+				(Queue.Num() < Settings.MaxQueuedRequests && QueuedBytes + RequestBytes <= Settings.MaxQueuedBytes))
+			{
+				QueuedBytes += RequestBytes;
+				Queue.Add(MoveTemp(Request));
+				QueueEvent->Trigger();
+				return true;
+			}
+		}
+		QueueSpaceEvent->Wait(FTimespan::FromSeconds(AcceptTimeoutSeconds));
+	}
+	return false;
+}
+
+bool FOVRLipSyncService::DequeueBatch(TArray<FPendingRequest> &OutBatch)
+{
+	while (!bStopping)
+	{
+		{
+			FScopeLock Lock(&QueueLock);
+			if (Queue.Num() > 0)
+			{
+				const auto BatchSize = FMath::Min(Settings.MaxBatchSize, Queue.Num());
+				for (int32 Idx = 0; Idx < BatchSize; ++Idx)
+				{
+					QueuedBytes -= Queue[Idx].PCMData.Num() * sizeof(int16);
+					OutBatch.Add(MoveTemp(Queue[Idx]));
+				}
+				Queue.RemoveAt(0, BatchSize);
+				QueueSpaceEvent->Trigger();
+				// Wakes up another worker for the rest of the queue
+				if (Queue.Num() > 0)
+				{
+					QueueEvent->Trigger();
+				}
+				return true;
+			}
+		}
+		QueueEvent->Wait(FTimespan::FromSeconds(AcceptTimeoutSeconds));
+	}
+	return false;
+}
+
+void FOVRLipSyncService::RecordRequest(double QueuedSeconds, double TotalSeconds, double AudioSeconds,
+									   bool bSuccess)
+{
+	FScopeLock Lock(&MetricsLock);
+	++Metrics.NumRequests;
+	++TotalRequests;
+	if (!bSuccess)
+	{
+		++Metrics.NumFailed;
+		return;
+	}
+	Metrics.AudioSeconds += AudioSeconds;
+	AddLatencySample(Metrics.QueuedMs, static_cast<float>(QueuedSeconds * 1000.0));
+	AddLatencySample(Metrics.TotalMs, static_cast<float>(TotalSeconds * 1000.0));
+}
+
+void FOVRLipSyncService::RecordBatch(int32 NumRequests, double BusySeconds)
+{
+	FScopeLock Lock(&MetricsLock);
+	++Metrics.NumBatches;
+	Metrics.NumBatchedRequests += NumRequests;
+	Metrics.BusySeconds += BusySeconds;
+}
+
+void FOVRLipSyncService::ReportMetrics()
+{
+	FMetrics Reported;
+	int32 QueueLength = 0;
+	{
+		FScopeLock Lock(&MetricsLock);
+		Reported = MoveTemp(Metrics);
+		Metrics = FMetrics();
+	}
+	{
+		FScopeLock Lock(&QueueLock);
+		QueueLength = Queue.Num();
+	}
+	const auto Now = FPlatformTime::Seconds();
+	const auto ElapsedSeconds = FMath::Max(Now - LastReportTime, 0.001);
+	LastReportTime = Now;
+	if (Reported.NumRequests == 0 && QueueLength == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogOvrLipSyncService, Display,
+		   TEXT("%.1f requests/s (%d failed), %.1fx realtime, %.1f requests/batch, %.0f%% of contexts busy, "
+				"%d queued, %d connections"),
+		   Reported.NumRequests / ElapsedSeconds, Reported.NumFailed, Reported.AudioSeconds / ElapsedSeconds,
+		   Reported.NumBatches > 0 ? static_cast<float>(Reported.NumBatchedRequests) / Reported.NumBatches : 0.0f,
+		   100.0 * Reported.BusySeconds / (ElapsedSeconds * Settings.NumContexts), QueueLength, Connections.Num());
+	UE_LOG(LogOvrLipSyncService, Display,
+		   TEXT("Latency ms: queued p50 %.1f p95 %.1f, total p50 %.1f p95 %.1f p99 %.1f max %.1f"),
+		   GetPercentile(Reported.QueuedMs, 0.5f), GetPercentile(Reported.QueuedMs, 0.95f),
+		   GetPercentile(Reported.TotalMs, 0.5f), GetPercentile(Reported.TotalMs, 0.95f),
+		   GetPercentile(Reported.TotalMs, 0.99f), GetPercentile(Reported.TotalMs, 1.0f));
+}
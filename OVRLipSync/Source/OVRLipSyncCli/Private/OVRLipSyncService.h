@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncService.h
+ * Content     :   Prototypes for OVRLipSync generation service
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncServiceProtocol.h"
+
+class FEvent;
+class FSocket;
+
+struct FOVRLipSyncServiceSettings
+{
+	int32 Port = FOVRLipSyncServiceProtocol::DefaultPort;
+	// Number of worker threads, each keeping its own warm analyzers
+	int32 NumContexts = 4;
+	// Requests a worker takes from the queue at once
+	int32 MaxBatchSize = 8;
+	// Connections stop reading new requests while the queue holds this many requests or bytes of audio,
+	// which pushes back on clients through TCP flow control
+	int32 MaxQueuedRequests = 64;
+	int64 MaxQueuedBytes = 256 * 1024 * 1024;
+	// Warm analyzers a worker keeps, the least recently used one is dropped for a new audio format
+	int32 MaxWarmContexts = 4;
+	FString AnalyzerName;
+	FOVRLipSyncAnalysisSettings AnalysisSettings;
+	// Time between metrics reports
+	float ReportIntervalSeconds = 5.0f;
+};
+
+// Accepts generation requests from local clients and spreads them over a pool of workers.
+// Workers take requests in batches and keep their analyzers between requests, so contexts are only
+// created once per sample rate.
+class FOVRLipSyncService
+{
+public:
+	explicit FOVRLipSyncService(const FOVRLipSyncServiceSettings &InSettings);
+	~FOVRLipSyncService();
+
+	// Serves requests until exit is requested, returns false if the service couldn't start
+	bool Run();
+
+private:
+	class FConnection;
+	class FWorker;
+
+	struct FPendingRequest
+	{
+		TSharedPtr<FConnection> Connection;
+		uint32 RequestId = 0;
+		int32 SampleRate = 0;
+		int32 NumChannels = 0;
+		TArray<int16> PCMData;
+		double ReceivedTime = 0.0;
+	};
+
+	// Waits for room in the queue, returns false if the service stopped meanwhile
+	bool Enqueue(FPendingRequest &&Request);
+	// Moves up to MaxBatchSize oldest requests to OutBatch, returns false once the service stops
+	bool DequeueBatch(TArray<FPendingRequest> &OutBatch);
+	void RecordRequest(double QueuedSeconds, double TotalSeconds, double AudioSeconds, bool bSuccess);
+	void RecordBatch(int32 NumRequests, double BusySeconds);
+	void ReportMetrics();
+
+	FOVRLipSyncServiceSettings Settings;
+	FSocket *ListenSocket = nullptr;
+	TArray<TSharedPtr<FConnection>> Connections;
+	TArray<TUniquePtr<FWorker>> Workers;
+
+	// Workers create analyzers one at a time, as that initializes the SDK
+	FCriticalSection AnalyzerLock;
+	FCriticalSection QueueLock;
+	TArray<FPendingRequest> Queue;
+	int64 QueuedBytes = 0;
+	FEvent *QueueEvent = nullptr;
+	// Triggered when workers take requests out of the queue
+	FEvent *QueueSpaceEvent = nullptr;
+	TAtomic<bool> bStopping{false};
+
+	// Counters since the last report, latencies of the last requests are kept for percentiles
+	struct FMetrics
+	{
+		int32 NumRequests = 0;
+		int32 NumFailed = 0;
+		int32 NumBatches = 0;
+		int32 NumBatchedRequests = 0;
+		double AudioSeconds = 0.0;
+		double BusySeconds = 0.0;
+		TArray<float> QueuedMs;
+		TArray<float> TotalMs;
+	};
+	FCriticalSection MetricsLock;
+	FMetrics Metrics;
+	uint64 TotalRequests = 0;
+	double LastReportTime = 0.0;
+};
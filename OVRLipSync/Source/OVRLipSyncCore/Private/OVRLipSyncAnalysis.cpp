@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncAnalysis.cpp
+ * Content     :   OVRLipSync chunked audio analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncAnalysis.h"
+
+#include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncCoreModule.h"
+
+static_assert(OVRLipSyncVisemeCount == ovrLipSyncViseme_Count, "Unexpected number of visemes");
+
+TUniquePtr<IOVRLipSyncAnalyzer> IOVRLipSyncAnalyzer::Create(const FString &Name, int32 SampleRate,
+															ovrLipSyncContextProvider Provider)
+{
+	if (Name == TEXT("Energy"))
+	{
+		return MakeUnique<FOVRLipSyncEnergyAnalyzer>();
+	}
+#if WITH_OVRLIPSYNC_SDK
+	if (Name == TEXT("Context"))
+	{
+		return MakeUnique<FOVRLipSyncContextAnalyzer>(Provider, SampleRate, 4096, FString(), true);
+	}
+#endif
+	UE_LOG(LogOvrLipSyncCore, Error, TEXT("Analyzer %s is not available on this platform"), *Name);
+	return nullptr;
+}
+
+FOVRLipSyncChunkedAnalysis::FOVRLipSyncChunkedAnalysis(IOVRLipSyncAnalyzer &InAnalyzer,
+													   const FOVRLipSyncAnalysisSettings &InSettings)
+	: Analyzer(InAnalyzer), Settings(InSettings)
+{
+	// Frame rate and chunking are derived from these, so invalid values fall back to defaults
+	const FOVRLipSyncAnalysisSettings Defaults;
+	if (!(Settings.HopMs > 0.0f))
+	{
+		UE_LOG(LogOvrLipSyncCore, Warning, TEXT("Invalid hop of %f ms, using %f ms"), Settings.HopMs, Defaults.HopMs);
+		Settings.HopMs = Defaults.HopMs;
+	}
+	if (!(Settings.WindowMs > 0.0f))
+	{
+		UE_LOG(LogOvrLipSyncCore, Warning, TEXT("Invalid window of %f ms, using the hop"), Settings.WindowMs);
+		Settings.WindowMs = Settings.HopMs;
+	}
+	else if (Settings.WindowMs > Settings.HopMs)
+	{
+		UE_LOG(LogOvrLipSyncCore, Warning, TEXT("Window of %f ms is longer than the hop, clamped to %f ms"),
+			   Settings.WindowMs, Settings.HopMs);
+		Settings.WindowMs = Settings.HopMs;
+	}
+
+	auto HopSizeSamples = FMath::Max(1, FMath::RoundToInt(Settings.SampleRate * Settings.HopMs / 1000.0f));
+	auto WindowSizeSamples = FMath::Max(1, FMath::RoundToInt(Settings.SampleRate * Settings.WindowMs / 1000.0f));
+	ChunkSizeSamples = FMath::Min(HopSizeSamples, WindowSizeSamples);
+	ChunkSize = Settings.NumChannels * ChunkSizeSamples;
+	HopSize = Settings.NumChannels * HopSizeSamples;
+	PaddedChunk.SetNumZeroed(ChunkSize);
+
+	// Feed a silent chunk to learn the frame delay of the analyzer. The delay is measured in analysed
+	// audio, so scale it up when part of every hop is skipped.
+	ProcessChunk(PaddedChunk.GetData());
+	FrameOffset = static_cast<int32>(static_cast<int64>(FrameDelayInMs) * Settings.SampleRate / 1000 *
+									 HopSizeSamples / ChunkSizeSamples) *
+				  Settings.NumChannels;
+}
+
+void FOVRLipSyncChunkedAnalysis::ProcessChunk(const int16 *Chunk)
+{
+	Analyzer.Analyze(Chunk, ChunkSizeSamples, Settings.NumChannels > 1, Visemes, LaughterScore, FrameDelayInMs);
+}
+
+int32 FOVRLipSyncChunkedAnalysis::GetNumFrames(int32 NumSamples) const
+{
+	// Chunks start at every multiple of HopSize below NumSamples + FrameOffset, frames are only
+	// emitted for chunks starting at or after FrameOffset
+	auto NumChunks = FMath::DivideAndRoundUp(NumSamples + FrameOffset, HopSize);
+	auto NumSkipped = FMath::DivideAndRoundUp(FrameOffset, HopSize);
+	return FMath::Max(0, NumChunks - NumSkipped);
+}
+
+float FOVRLipSyncChunkedAnalysis::GetFrameRate() const
+{
+	return static_cast<float>(Settings.SampleRate * Settings.NumChannels) / HopSize;
+}
+
+bool FOVRLipSyncChunkedAnalysis::Generate(const int16 *PCMData, int32 NumSamples, TArray<float> &OutVisemes,
+										  TArray<float> &OutLaughterScores, FProgressCallback Progress)
+{
+	if (bAnalyzerDirty)
+	{
+		// Drop state left by the previous sound and re-prime the analyzer, so every call starts
+		// from the same state as a freshly created one
+		Analyzer.Reset();
+		FMemory::Memzero(PaddedChunk.GetData(), PaddedChunk.Num() * sizeof(int16));
+		ProcessChunk(PaddedChunk.GetData());
+	}
+	bAnalyzerDirty = true;
+
+	const auto NumFrames = GetNumFrames(NumSamples);
+	OutVisemes.Reserve(OutVisemes.Num() + NumFrames * OVRLipSyncVisemeCount);
+	OutLaughterScores.Reserve(OutLaughterScores.Num() + NumFrames);
+
+	const auto TotalSamples = NumSamples + FrameOffset;
+	for (int32 Offs = 0; Offs < TotalSamples; Offs += HopSize)
+	{
+		const auto RemainingSamples = NumSamples - Offs;
+		if (RemainingSamples >= ChunkSize)
+		{
+			ProcessChunk(PCMData + Offs);
+		}
+		else
+		{
+			// Pad the tail of the sound, and the frame delay past it, with silence
+			const auto NumCopied = FMath::Max(RemainingSamples, 0);
+			if (NumCopied > 0)
+			{
+				FMemory::Memcpy(PaddedChunk.GetData(), PCMData + Offs, NumCopied * sizeof(int16));
+			}
+			FMemory::Memzero(PaddedChunk.GetData() + NumCopied, (ChunkSize - NumCopied) * sizeof(int16));
+			ProcessChunk(PaddedChunk.GetData());
+		}
+
+		if (Offs >= FrameOffset)
+		{
+			OutVisemes.Append(Visemes, OVRLipSyncVisemeCount);
+			OutLaughterScores.Add(LaughterScore);
+		}
+		if (!Progress(FMath::Min(1.0f, static_cast<float>(Offs + HopSize) / TotalSamples)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#if WITH_OVRLIPSYNC_SDK
+FOVRLipSyncContextAnalyzer::FOVRLipSyncContextAnalyzer(ovrLipSyncContextProvider Provider, int32 SampleRate,
+													   int32 BufferSize, const FString &ModelPath,
+													   bool bEnableAcceleration)
+	: Context(MakeUnique<UOVRLipSyncContextWrapper>(Provider, SampleRate, BufferSize, ModelPath, bEnableAcceleration))
+{
+	ContextVisemes.SetNumZeroed(OVRLipSyncVisemeCount);
+}
+
+FOVRLipSyncContextAnalyzer::~FOVRLipSyncContextAnalyzer() = default;
+
+void FOVRLipSyncContextAnalyzer::Analyze(const int16 *Chunk, int32 NumSamples, bool bStereo, float *OutVisemes,
+										 float &OutLaughterScore, int32 &OutFrameDelayMs)
+{
+	int32_t FrameDelay = OutFrameDelayMs;
+	Context->ProcessFrame(Chunk, NumSamples, ContextVisemes, OutLaughterScore, FrameDelay, bStereo);
+	OutFrameDelayMs = FrameDelay;
+	FMemory::Memcpy(OutVisemes, ContextVisemes.GetData(), OVRLipSyncVisemeCount * sizeof(float));
+}
+
+void FOVRLipSyncContextAnalyzer::Reset() { Context->Reset(); }
+#endif
+
+void FOVRLipSyncEnergyAnalyzer::Analyze(const int16 *Chunk, int32 NumSamples, bool bStereo, float *OutVisemes,
+										float &OutLaughterScore, int32 &OutFrameDelayMs)
+{
+	const auto Count = NumSamples * (bStereo ? 2 : 1);
+	double SumSquares = 0.0;
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+	{
+		SumSquares += static_cast<double>(Chunk[Idx]) * Chunk[Idx];
+	}
+	const auto Rms = Count > 0 ? FMath::Sqrt(SumSquares / Count) / 32768.0 : 0.0;
+	// -50 dBFS reads as silence, -10 dBFS as a fully open mouth
+	const auto Level =
+		Rms > 0.0 ? static_cast<float>(FMath::Clamp((20.0 * FMath::LogX(10.0, Rms) + 50.0) / 40.0, 0.0, 1.0)) : 0.0f;
+
+	FMemory::Memzero(OutVisemes, OVRLipSyncVisemeCount * sizeof(float));
+	OutVisemes[0] = 1.0f - Level;
+	OutVisemes[10] = Level;
+	OutLaughterScore = 0.0f;
+	OutFrameDelayMs = 0;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncBankFormat.cpp
+ * Content     :   OVRLipSync sequence bank format
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncBankFormat.h"
+
+#include "Hash/CityHash.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncCoreModule.h"
+
+uint64 FOVRLipSyncBankFormat::HashLineId(const FString &LineId)
+{
+	const FTCHARToUTF8 Utf8(*LineId.ToLower());
+	return CityHash64(Utf8.Get(), Utf8.Length());
+}
+
+bool FOVRLipSyncBankFormat::Write(TArrayView<const FOVRLipSyncBankLine> Lines, TArray<uint8> &OutBytes)
+{
+	TArray<FOVRLipSyncBankEntry> Entries;
+	Entries.Reserve(Lines.Num());
+	uint32 NumFrames = 0;
+	for (const auto &Line : Lines)
+	{
+		if (Line.Visemes.Num() != Line.LaughterScores.Num() * OVRLipSyncVisemeCount)
+		{
+			UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't write sequence bank: frames of %s are inconsistent"),
+				   *Line.LineId);
+			return false;
+		}
+		const auto LineFrames = static_cast<uint32>(Line.LaughterScores.Num());
+		Entries.Add({HashLineId(Line.LineId), NumFrames, LineFrames, Line.FrameRate, 0});
+		NumFrames += LineFrames;
+	}
+	Entries.Sort([](const FOVRLipSyncBankEntry &A, const FOVRLipSyncBankEntry &B) { return A.Hash < B.Hash; });
+	for (int32 Idx = 1; Idx < Entries.Num(); ++Idx)
+	{
+		if (Entries[Idx].Hash == Entries[Idx - 1].Hash)
+		{
+			// Lines are only looked up again to name them in the error
+			TArray<FString, TInlineAllocator<2>> LineIds;
+			for (const auto &Line : Lines)
+			{
+				if (HashLineId(Line.LineId) == Entries[Idx].Hash)
+				{
+					LineIds.Add(Line.LineId);
+				}
+			}
+			UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't write sequence bank: line IDs %s and %s %s"), *LineIds[0],
+				   *LineIds[1],
+				   LineIds[0].Equals(LineIds[1], ESearchCase::IgnoreCase) ? TEXT("are duplicates")
+																		   : TEXT("have the same hash"));
+			return false;
+		}
+	}
+
+	FOVRLipSyncBankHeader Header = {Magic, Version, static_cast<uint32>(Entries.Num()), NumFrames};
+	OutBytes.Reset(sizeof(FOVRLipSyncBankHeader) + Entries.Num() * sizeof(FOVRLipSyncBankEntry) +
+				   NumFrames * (OVRLipSyncVisemeCount + 1) * sizeof(float));
+	OutBytes.Append(reinterpret_cast<const uint8 *>(&Header), sizeof(Header));
+	OutBytes.Append(reinterpret_cast<const uint8 *>(Entries.GetData()), Entries.Num() * sizeof(FOVRLipSyncBankEntry));
+	// Frames are written in the original order, entries refer to them by FirstFrame
+	for (const auto &Line : Lines)
+	{
+		OutBytes.Append(reinterpret_cast<const uint8 *>(Line.Visemes.GetData()), Line.Visemes.Num() * sizeof(float));
+	}
+	for (const auto &Line : Lines)
+	{
+		OutBytes.Append(reinterpret_cast<const uint8 *>(Line.LaughterScores.GetData()),
+						Line.LaughterScores.Num() * sizeof(float));
+	}
+	return true;
+}
+
+bool FOVRLipSyncBankFormat::Validate(const uint8 *Data, int64 DataSize)
+{
+	if (DataSize < static_cast<int64>(sizeof(FOVRLipSyncBankHeader)))
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Sequence bank is too small: %lld bytes"), DataSize);
+		return false;
+	}
+	const auto &Header = GetHeader(Data);
+	if (Header.Magic != Magic || Header.Version != Version)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Unsupported sequence bank format: magic %08x version %u"),
+			   Header.Magic, Header.Version);
+		return false;
+	}
+	const auto ExpectedSize = static_cast<int64>(sizeof(FOVRLipSyncBankHeader)) +
+							  Header.NumEntries * sizeof(FOVRLipSyncBankEntry) +
+							  static_cast<int64>(Header.NumFrames) * (OVRLipSyncVisemeCount + 1) * sizeof(float);
+	if (DataSize < ExpectedSize)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Sequence bank is truncated: %lld bytes, expected %lld"), DataSize,
+			   ExpectedSize);
+		return false;
+	}
+	// Lookups binary search the entries and read their frames without further checks
+	const auto Entries = GetEntries(Data);
+	for (int32 Idx = 0; Idx < Entries.Num(); ++Idx)
+	{
+		const auto &Entry = Entries[Idx];
+		if (static_cast<uint64>(Entry.FirstFrame) + Entry.NumFrames > Header.NumFrames)
+		{
+			UE_LOG(LogOvrLipSyncCore, Error, TEXT("Sequence bank entry %d refers to frames %u-%u of %u"), Idx,
+				   Entry.FirstFrame, Entry.FirstFrame + Entry.NumFrames, Header.NumFrames);
+			return false;
+		}
+		if (Idx > 0 && Entry.Hash <= Entries[Idx - 1].Hash)
+		{
+			UE_LOG(LogOvrLipSyncCore, Error, TEXT("Sequence bank entries are not sorted by unique hashes"));
+			return false;
+		}
+	}
+	return true;
+}
+
+const float *FOVRLipSyncBankFormat::GetVisemes(const uint8 *Data)
+{
+	return reinterpret_cast<const float *>(Data + sizeof(FOVRLipSyncBankHeader) +
+										   GetHeader(Data).NumEntries * sizeof(FOVRLipSyncBankEntry));
+}
+
+const float *FOVRLipSyncBankFormat::GetLaughterScores(const uint8 *Data)
+{
+	return GetVisemes(Data) + GetHeader(Data).NumFrames * OVRLipSyncVisemeCount;
+}
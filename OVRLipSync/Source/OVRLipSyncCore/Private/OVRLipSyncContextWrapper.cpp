@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncContextWrapper.cpp
+ * Content     :   Wrapper around OVRLipSync API
+ * Created     :   Sep 14th, 2018
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncContextWrapper.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncCoreModule.h"
+
+#include <Core.h>
+#include <algorithm>
+
+#if WITH_OVRLIPSYNC_SDK
+
+FString UOVRLipSyncContextWrapper::LibraryDirectory;
+
+void UOVRLipSyncContextWrapper::SetLibraryDirectory(const FString &Directory) { LibraryDirectory = Directory; }
+
+UOVRLipSyncContextWrapper::UOVRLipSyncContextWrapper(ovrLipSyncContextProvider ProviderKind, int SampleRate,
+													 int BufferSize, FString ModelPath, bool EnableAcceleration)
+{
+#if !PLATFORM_ANDROID
+	auto pluginsDir = FPaths::ProjectPluginsDir();
+	auto libDir = !LibraryDirectory.IsEmpty() ? LibraryDirectory
+											   : FPaths::Combine(pluginsDir, TEXT("OVRLipSync"), TEXT("ThirdParty"),
+																 TEXT("Lib"), FPlatformProcess::GetBinariesSubdirectory());
+
+	TArray<char> libDirChar(libDir.GetCharArray());
+	auto rc = ovrLipSync_InitializeEx(SampleRate, BufferSize, libDirChar.GetData());
+#else
+	auto rc = ovrLipSync_Initialize(SampleRate, BufferSize);
+#endif
+	if (rc != ovrLipSyncSuccess)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't initialize ovrLipSync: %d"), rc);
+		return;
+	}
+	rc = ModelPath.IsEmpty()
+			 ? ovrLipSync_CreateContextEx(&LipSyncContext, ProviderKind, SampleRate, EnableAcceleration)
+			 : ovrLipSync_CreateContextWithModelFile(&LipSyncContext, ProviderKind, TCHAR_TO_ANSI(*ModelPath),
+													 SampleRate, EnableAcceleration);
+	if (rc != ovrLipSyncSuccess)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't create ovrLipSync context: %d"), rc);
+	}
+}
+
+UOVRLipSyncContextWrapper::~UOVRLipSyncContextWrapper() { ovrLipSync_DestroyContext(LipSyncContext); }
+
+void UOVRLipSyncContextWrapper::ProcessFrame(const int16_t *AudioBuffer, int AudioBufferSize, TArray<float> &Visemes,
+											 float &LaughterScore, int32_t &FrameDelay, bool Stereo)
+{
+	ProcessFrame(AudioBuffer, AudioBufferSize,
+				 Stereo ? ovrLipSyncAudioDataType_S16_Stereo : ovrLipSyncAudioDataType_S16_Mono, Visemes,
+				 LaughterScore, FrameDelay);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrame(const float *AudioBuffer, int AudioBufferSize, TArray<float> &Visemes,
+											 float &LaughterScore, int32_t &FrameDelay, bool Stereo)
+{
+	ProcessFrame(AudioBuffer, AudioBufferSize,
+				 Stereo ? ovrLipSyncAudioDataType_F32_Stereo : ovrLipSyncAudioDataType_F32_Mono, Visemes,
+				 LaughterScore, FrameDelay);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrame(const void *AudioBuffer, int AudioBufferSize,
+											 ovrLipSyncAudioDataType DataType, TArray<float> &Visemes,
+											 float &LaughterScore, int32_t &FrameDelay)
+{
+	if (Visemes.Num() != ovrLipSyncViseme_Count)
+	{
+		Visemes.SetNumZeroed(ovrLipSyncViseme_Count);
+	}
+	ovrLipSyncFrame frame = {};
+	frame.visemes = Visemes.GetData();
+	frame.visemesLength = Visemes.Num();
+	auto rc = ovrLipSync_ProcessFrameEx(LipSyncContext, AudioBuffer, AudioBufferSize, DataType, &frame);
+	if (rc != ovrLipSyncSuccess)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Failed to process frame: %d"), rc);
+		return;
+	}
+	LaughterScore = frame.laughterScore;
+	FrameDelay = frame.frameDelay;
+}
+
+void UOVRLipSyncContextWrapper::Reset()
+{
+	auto rc = ovrLipSync_ResetContext(LipSyncContext);
+	if (rc != ovrLipSyncSuccess)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Failed to reset context: %d"), rc);
+	}
+}
+
+namespace
+{
+// Travels with each frame through the SDK, so failed predictions can't shift submit times onto later ones
+struct FAsyncRequest
+{
+	UOVRLipSyncContextWrapper *Wrapper;
+	double SubmitTime;
+};
+
+void ProcessFrameCallback(void *opaque, const ovrLipSyncFrame *pFrame, ovrLipSyncResult result)
+{
+	TUniquePtr<FAsyncRequest> Request(reinterpret_cast<FAsyncRequest *>(opaque));
+	if (result != ovrLipSyncSuccess)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Async prediction failed: %d"), result);
+		return;
+	}
+	TArray<float> Visemes(pFrame->visemes, pFrame->visemesLength);
+	Request->Wrapper->InvokeAsyncCallback(Visemes, pFrame->laughterScore, Request->SubmitTime);
+}
+} // namespace
+
+void UOVRLipSyncContextWrapper::SetAsyncCallback(const AsyncCallbackType &Callback) { AsyncCallback = Callback; }
+
+void UOVRLipSyncContextWrapper::InvokeAsyncCallback(const TArray<float> &Visemes, float LaughterScore,
+													 double SubmitTime)
+{
+	if (!AsyncCallback)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Trying invoke unintialized async callback"));
+		return;
+	}
+	AsyncCallback(Visemes, LaughterScore, SubmitTime);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrameAsync(const int16_t *AudioBuffer, int AudioBufferSize, bool Stereo)
+{
+	ProcessFrameAsync(AudioBuffer, AudioBufferSize,
+					  Stereo ? ovrLipSyncAudioDataType_S16_Stereo : ovrLipSyncAudioDataType_S16_Mono);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrameAsync(const float *AudioBuffer, int AudioBufferSize, bool Stereo)
+{
+	ProcessFrameAsync(AudioBuffer, AudioBufferSize,
+					  Stereo ? ovrLipSyncAudioDataType_F32_Stereo : ovrLipSyncAudioDataType_F32_Mono);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrameAsync(const void *AudioBuffer, int AudioBufferSize,
+												  ovrLipSyncAudioDataType DataType)
+{
+	auto Request = new FAsyncRequest{this, FPlatformTime::Seconds()};
+	auto rc = ovrLipSync_ProcessFrameAsync(LipSyncContext, AudioBuffer, AudioBufferSize, DataType,
+										   ProcessFrameCallback, Request);
+	if (rc != ovrLipSyncSuccess)
+	{
+		// The callback only runs for frames the SDK accepted
+		delete Request;
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Failed to start async prediction: %d"), rc);
+		return;
+	}
+}
+
+#else // WITH_OVRLIPSYNC_SDK
+
+FString UOVRLipSyncContextWrapper::LibraryDirectory;
+
+void UOVRLipSyncContextWrapper::SetLibraryDirectory(const FString &Directory) { LibraryDirectory = Directory; }
+
+UOVRLipSyncContextWrapper::UOVRLipSyncContextWrapper(ovrLipSyncContextProvider ProviderKind, int SampleRate,
+													 int BufferSize, FString ModelPath, bool EnableAcceleration)
+	: StandInAnalyzer(MakeUnique<FOVRLipSyncEnergyAnalyzer>())
+{
+}
+
+UOVRLipSyncContextWrapper::~UOVRLipSyncContextWrapper() = default;
+
+void UOVRLipSyncContextWrapper::ProcessFrame(const int16_t *AudioBuffer, int AudioBufferSize, TArray<float> &Visemes,
+											 float &LaughterScore, int32_t &FrameDelay, bool Stereo)
+{
+	if (Visemes.Num() != OVRLipSyncVisemeCount)
+	{
+		Visemes.SetNumZeroed(OVRLipSyncVisemeCount);
+	}
+	int32 FrameDelayMs = 0;
+	StandInAnalyzer->Analyze(AudioBuffer, AudioBufferSize, Stereo, Visemes.GetData(), LaughterScore, FrameDelayMs);
+	FrameDelay = FrameDelayMs;
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrame(const float *AudioBuffer, int AudioBufferSize, TArray<float> &Visemes,
+											 float &LaughterScore, int32_t &FrameDelay, bool Stereo)
+{
+	// The stand-in only takes 16-bit audio
+	StandInSamples.SetNumUninitialized(AudioBufferSize * (Stereo ? 2 : 1));
+	for (int32 Idx = 0; Idx < StandInSamples.Num(); ++Idx)
+	{
+		StandInSamples[Idx] = static_cast<int16>(FMath::Clamp(AudioBuffer[Idx], -1.0f, 1.0f) * 32767.0f);
+	}
+	ProcessFrame(StandInSamples.GetData(), AudioBufferSize, Visemes, LaughterScore, FrameDelay, Stereo);
+}
+
+void UOVRLipSyncContextWrapper::Reset() { StandInAnalyzer->Reset(); }
+
+void UOVRLipSyncContextWrapper::SetAsyncCallback(const AsyncCallbackType &Callback) { AsyncCallback = Callback; }
+
+void UOVRLipSyncContextWrapper::InvokeAsyncCallback(const TArray<float> &Visemes, float LaughterScore,
+													 double SubmitTime)
+{
+	if (!AsyncCallback)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Trying invoke unintialized async callback"));
+		return;
+	}
+	AsyncCallback(Visemes, LaughterScore, SubmitTime);
+}
+
+// The stand-in is cheap enough to run on the submitting thread, the callback is invoked before returning
+void UOVRLipSyncContextWrapper::ProcessFrameAsync(const int16_t *AudioBuffer, int AudioBufferSize, bool Stereo)
+{
+	const auto SubmitTime = FPlatformTime::Seconds();
+	TArray<float> Visemes;
+	float LaughterScore = 0.0f;
+	int32_t FrameDelay = 0;
+	ProcessFrame(AudioBuffer, AudioBufferSize, Visemes, LaughterScore, FrameDelay, Stereo);
+	InvokeAsyncCallback(Visemes, LaughterScore, SubmitTime);
+}
+
+void UOVRLipSyncContextWrapper::ProcessFrameAsync(const float *AudioBuffer, int AudioBufferSize, bool Stereo)
+{
+	const auto SubmitTime = FPlatformTime::Seconds();
+	TArray<float> Visemes;
+	float LaughterScore = 0.0f;
+	int32_t FrameDelay = 0;
+	ProcessFrame(AudioBuffer, AudioBufferSize, Visemes, LaughterScore, FrameDelay, Stereo);
+	InvokeAsyncCallback(Visemes, LaughterScore, SubmitTime);
+}
+
+#endif // WITH_OVRLIPSYNC_SDK
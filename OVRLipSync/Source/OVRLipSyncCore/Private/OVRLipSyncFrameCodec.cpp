@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFrameCodec.cpp
+ * Content     :   OVRLipSync frame encoding
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncFrameCodec.h"
+
+#include "OVRLipSyncAnalysis.h"
+
+void FOVRLipSyncFrameCodec::Decimate(TArrayView<const float> Visemes, TArrayView<const float> LaughterScores,
+									 int32 Factor, TArray<float> &OutVisemes, TArray<float> &OutLaughterScores)
+{
+	const auto NumFrames = LaughterScores.Num();
+	const auto NumOutFrames = FMath::DivideAndRoundUp(NumFrames, Factor);
+	OutVisemes.SetNumUninitialized(NumOutFrames * OVRLipSyncVisemeCount);
+	OutLaughterScores.SetNumUninitialized(NumOutFrames);
+	for (int32 OutFrame = 0; OutFrame < NumOutFrames; ++OutFrame)
+	{
+		const auto First = OutFrame * Factor;
+		const auto Count = FMath::Min(Factor, NumFrames - First);
+		float Sum[OVRLipSyncVisemeCount + 1] = {};
+		for (int32 Frame = First; Frame < First + Count; ++Frame)
+		{
+			for (int32 Viseme = 0; Viseme < OVRLipSyncVisemeCount; ++Viseme)
+			{
+				Sum[Viseme] += Visemes[Frame * OVRLipSyncVisemeCount + Viseme];
+			}
+			Sum[OVRLipSyncVisemeCount] += LaughterScores[Frame];
+		}
+		for (int32 Viseme = 0; Viseme < OVRLipSyncVisemeCount; ++Viseme)
+		{
+			OutVisemes[OutFrame * OVRLipSyncVisemeCount + Viseme] = Sum[Viseme] / Count;
+		}
+		OutLaughterScores[OutFrame] = Sum[OVRLipSyncVisemeCount] / Count;
+	}
+}
+
+int32 FOVRLipSyncFrameCodec::EncodeKeyframes(const float *Scores, int32 NumFrames, int32 Stride, float Tolerance,
+											 TArray<uint8> &OutKeyScores, TArray<uint8> &OutKeyGaps)
+{
+	if (NumFrames == 0)
+	{
+		return 0;
+	}
+	auto NumKeys = 0;
+	auto LastKey = 0;
+	auto AddKey = [&](int32 Frame) {
+		OutKeyGaps.Add(static_cast<uint8>(Frame - LastKey));
+		OutKeyScores.Add(Quantize(Scores[Frame * Stride]));
+		LastKey = Frame;
+		++NumKeys;
+	};
+	// Whether frames between the last key and End stay within tolerance of the line between them
+	auto Fits = [&](int32 End) {
+		const auto Start = Dequantize(OutKeyScores.Last());
+		const auto Stop = Dequantize(Quantize(Scores[End * Stride]));
+		for (int32 Frame = LastKey + 1; Frame < End; ++Frame)
+		{
+			const auto Alpha = static_cast<float>(Frame - LastKey) / (End - LastKey);
+			if (FMath::Abs(FMath::Lerp(Start, Stop, Alpha) - Scores[Frame * Stride]) > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	AddKey(0);
+	for (int32 End = 2; End < NumFrames; ++End)
+	{
+		if (End - LastKey > MaxKeyGap || !Fits(End))
+		{
+			AddKey(End - 1);
+		}
+	}
+	if (LastKey != NumFrames - 1)
+	{
+		AddKey(NumFrames - 1);
+	}
+	return NumKeys;
+}
+
+void FOVRLipSyncFrameCodec::DecodeKeyframes(const uint8 *KeyScores, const uint8 *KeyGaps, int32 NumKeys,
+											float *OutScores, int32 Stride)
+{
+	auto Frame = 0;
+	for (int32 Key = 0; Key < NumKeys; ++Key)
+	{
+		const auto KeyFrame = Frame + KeyGaps[Key];
+		const auto KeyScore = Dequantize(KeyScores[Key]);
+		if (Key > 0)
+		{
+			const auto PrevScore = Dequantize(KeyScores[Key - 1]);
+			for (int32 Between = Frame + 1; Between < KeyFrame; ++Between)
+			{
+				OutScores[Between * Stride] =
+					FMath::Lerp(PrevScore, KeyScore, static_cast<float>(Between - Frame) / (KeyFrame - Frame));
+			}
+		}
+		OutScores[KeyFrame * Stride] = KeyScore;
+		Frame = KeyFrame;
+	}
+}
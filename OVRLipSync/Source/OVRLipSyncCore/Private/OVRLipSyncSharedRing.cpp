@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSharedRing.cpp
+ * Content     :   OVRLipSync shared memory ring buffer
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncSharedRing.h"
+
+#include "OVRLipSyncCoreModule.h"
+
+namespace
+{
+constexpr uint32 RingMagic = 0x524C4C4F; // "OLLR"
+// Records are padded so their size prefix stays aligned
+constexpr uint32 RecordAlignment = sizeof(uint32);
+} // namespace
+
+FOVRLipSyncSharedRing::~FOVRLipSyncSharedRing() { Close(); }
+
+bool FOVRLipSyncSharedRing::Create(const FString &Name, uint32 Capacity)
+{
+	Capacity = Align(FMath::Max(Capacity, 1u), RecordAlignment);
+	if (!Map(Name, Capacity, true))
+	{
+		return false;
+	}
+	new (Header) FHeader();
+	Header->Capacity = Capacity;
+	Header->bClosed = 0;
+	Header->WriteOffset = 0;
+	Header->ReadOffset = 0;
+	// Published last, Open checks it before trusting the rest of the header
+	FPlatformMisc::MemoryBarrier();
+	Header->Magic = RingMagic;
+	bCreated = true;
+	return true;
+}
+
+bool FOVRLipSyncSharedRing::Open(const FString &Name)
+{
+	// The header is mapped first to learn the capacity, then the whole region
+	if (!Map(Name, 0, false))
+	{
+		return false;
+	}
+	const auto Magic = Header->Magic;
+	const auto Capacity = Header->Capacity;
+	Close();
+	if (Magic != RingMagic)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Shared ring %s isn't initialized"), *Name);
+		return false;
+	}
+	return Map(Name, Capacity, false);
+}
+
+bool FOVRLipSyncSharedRing::Map(const FString &Name, uint32 Capacity, bool bCreate)
+{
+	const auto Access = FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write;
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, bCreate, Access, sizeof(FHeader) + Capacity);
+	if (!Region)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't map shared ring %s"), *Name);
+		return false;
+	}
+	Header = static_cast<FHeader *>(Region->GetAddress());
+	Data = static_cast<uint8 *>(Region->GetAddress()) + sizeof(FHeader);
+	return true;
+}
+
+void FOVRLipSyncSharedRing::Close()
+{
+	if (!Region)
+	{
+		return;
+	}
+	if (bCreated)
+	{
+		Header->bClosed = 1;
+	}
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	Region = nullptr;
+	Header = nullptr;
+	Data = nullptr;
+	bCreated = false;
+}
+
+bool FOVRLipSyncSharedRing::IsClosed() const { return !Header || Header->bClosed.Load(EMemoryOrder::Relaxed) != 0; }
+
+uint64 FOVRLipSyncSharedRing::GetWriteOffset() const { return Header ? Header->WriteOffset.Load() : 0; }
+
+uint64 FOVRLipSyncSharedRing::GetReadOffset() const { return Header ? Header->ReadOffset.Load() : 0; }
+
+bool FOVRLipSyncSharedRing::Write(const void *RecordHeader, uint32 HeaderSize, const void *Payload,
+								  uint32 PayloadSize)
+{
+	if (!Header)
+	{
+		return false;
+	}
+	const auto Size = HeaderSize + PayloadSize;
+	const auto RecordSize = Align(static_cast<uint64>(sizeof(uint32)) + Size, RecordAlignment);
+	// Only the producer moves WriteOffset, the consumer's ReadOffset may only grow while we look at it
+	const auto WriteOffset = Header->WriteOffset.Load(EMemoryOrder::Relaxed);
+	const auto ReadOffset = Header->ReadOffset.Load();
+	if (WriteOffset - ReadOffset + RecordSize > Header->Capacity)
+	{
+		return false;
+	}
+	CopyIn(WriteOffset, &Size, sizeof(Size));
+	CopyIn(WriteOffset + sizeof(Size), RecordHeader, HeaderSize);
+	if (PayloadSize > 0)
+	{
+		CopyIn(WriteOffset + sizeof(Size) + HeaderSize, Payload, PayloadSize);
+	}
+	Header->WriteOffset.Store(WriteOffset + RecordSize);
+	return true;
+}
+
+bool FOVRLipSyncSharedRing::Read(TArray<uint8> &OutRecord)
+{
+	if (!Header)
+	{
+		return false;
+	}
+	const auto ReadOffset = Header->ReadOffset.Load(EMemoryOrder::Relaxed);
+	const auto WriteOffset = Header->WriteOffset.Load();
+	if (ReadOffset == WriteOffset)
+	{
+		return false;
+	}
+	uint32 Size = 0;
+	CopyOut(ReadOffset, &Size, sizeof(Size));
+	const auto RecordSize = Align(static_cast<uint64>(sizeof(uint32)) + Size, RecordAlignment);
+	if (RecordSize > WriteOffset - ReadOffset)
+	{
+		// Only a corrupted region gets here, everything in it is dropped
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Corrupted shared ring record of %u bytes"), Size);
+		Header->ReadOffset.Store(WriteOffset);
+		return false;
+	}
+	OutRecord.SetNumUninitialized(Size);
+	CopyOut(ReadOffset + sizeof(Size), OutRecord.GetData(), Size);
+	Header->ReadOffset.Store(ReadOffset + RecordSize);
+	return true;
+}
+
+void FOVRLipSyncSharedRing::Discard()
+{
+	if (Header)
+	{
+		Header->ReadOffset.Store(Header->WriteOffset.Load());
+	}
+}
+
+void FOVRLipSyncSharedRing::CopyIn(uint64 Offset, const void *Source, uint32 Size)
+{
+	const auto Position = static_cast<uint32>(Offset % Header->Capacity);
+	const auto FirstPart = FMath::Min(Size, Header->Capacity - Position);
+	FMemory::Memcpy(Data + Position, Source, FirstPart);
+	FMemory::Memcpy(Data, static_cast<const uint8 *>(Source) + FirstPart, Size - FirstPart);
+}
+
+void FOVRLipSyncSharedRing::CopyOut(uint64 Offset, void *Dest, uint32 Size) const
+{
+	const auto Position = static_cast<uint32>(Offset % Header->Capacity);
+	const auto FirstPart = FMath::Min(Size, Header->Capacity - Position);
+	FMemory::Memcpy(Dest, Data + Position, FirstPart);
+	FMemory::Memcpy(static_cast<uint8 *>(Dest) + FirstPart, Data, Size - FirstPart);
+}
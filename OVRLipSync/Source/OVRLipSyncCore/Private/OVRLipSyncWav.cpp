@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncWav.cpp
+ * Content     :   OVRLipSync WAV parsing
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncWav.h"
+
+#include "Misc/FileHelper.h"
+#include "OVRLipSyncCoreModule.h"
+
+namespace
+{
+struct FRiffHeader
+{
+	char RIFF[4]; // "RIFF"
+	uint32 ChunkSize;
+	char WAVE[4]; // "WAVE"
+};
+
+struct FWavChunkHeader
+{
+	char Id[4];
+	uint32 Size;
+};
+
+// Leading fields of the fmt chunk, which may be longer for extended formats
+struct FWavFormat
+{
+	uint16 AudioFormat; // 1 = PCM
+	uint16 NumChannels;
+	uint32 SampleRate;
+	uint32 ByteRate;
+	uint16 BlockAlign;
+	uint16 BitsPerSample;
+};
+} // namespace
+
+bool FOVRLipSyncWav::ParseHeader(TArrayView<const uint8> WavData, FOVRLipSyncWavInfo &OutInfo)
+{
+	const int64 DataSize = WavData.Num();
+	if (DataSize < static_cast<int64>(sizeof(FRiffHeader) + sizeof(FWavChunkHeader)))
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("WAV data too small: %d bytes"), WavData.Num());
+		return false;
+	}
+	const auto Header = reinterpret_cast<const FRiffHeader *>(WavData.GetData());
+	if (FMemory::Memcmp(Header->RIFF, "RIFF", 4) != 0 || FMemory::Memcmp(Header->WAVE, "WAVE", 4) != 0)
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Invalid WAV header"));
+		return false;
+	}
+
+	// Chunks are walked in 64-bit so sizes near 4GB can't wrap the offset around. Chunks other than fmt
+	// and data are skipped, including the pad byte following odd sized ones.
+	const FWavFormat *Format = nullptr;
+	int64 Offset = sizeof(FRiffHeader);
+	while (Offset + static_cast<int64>(sizeof(FWavChunkHeader)) <= DataSize)
+	{
+		const auto Chunk = reinterpret_cast<const FWavChunkHeader *>(WavData.GetData() + Offset);
+		Offset += sizeof(FWavChunkHeader);
+		const int64 ChunkSize = Chunk->Size;
+		if (FMemory::Memcmp(Chunk->Id, "fmt ", 4) == 0)
+		{
+			if (ChunkSize < static_cast<int64>(sizeof(FWavFormat)) || Offset + ChunkSize > DataSize)
+			{
+				UE_LOG(LogOvrLipSyncCore, Error, TEXT("Invalid WAV fmt chunk of %lld bytes"), ChunkSize);
+				return false;
+			}
+			Format = reinterpret_cast<const FWavFormat *>(WavData.GetData() + Offset);
+		}
+		else if (FMemory::Memcmp(Chunk->Id, "data", 4) == 0)
+		{
+			if (!Format)
+			{
+				UE_LOG(LogOvrLipSyncCore, Error, TEXT("WAV data chunk precedes the fmt chunk"));
+				return false;
+			}
+			if (Format->AudioFormat != 1)
+			{
+				UE_LOG(LogOvrLipSyncCore, Error, TEXT("Unsupported audio format: %u (only PCM is supported)"),
+					   Format->AudioFormat);
+				return false;
+			}
+			if (Format->BitsPerSample != 16)
+			{
+				UE_LOG(LogOvrLipSyncCore, Error, TEXT("Unsupported bits per sample: %u (only 16-bit is supported)"),
+					   Format->BitsPerSample);
+				return false;
+			}
+			OutInfo.SampleRate = Format->SampleRate;
+			OutInfo.NumChannels = Format->NumChannels;
+			OutInfo.PCMDataOffset = static_cast<uint32>(Offset);
+			OutInfo.PCMDataSize = Chunk->Size;
+			return true;
+		}
+		if (Offset + ChunkSize > DataSize)
+		{
+			break;
+		}
+		Offset += ChunkSize + (ChunkSize & 1);
+	}
+	UE_LOG(LogOvrLipSyncCore, Error, TEXT("WAV data chunk not found"));
+	return false;
+}
+
+bool FOVRLipSyncWav::LoadFile(const FString &FilePath, TArray<int16> &OutPCMData, FOVRLipSyncWavInfo &OutInfo)
+{
+	TArray<uint8> WavData;
+	if (!FFileHelper::LoadFileToArray(WavData, *FilePath))
+	{
+		UE_LOG(LogOvrLipSyncCore, Error, TEXT("Can't read %s"), *FilePath);
+		return false;
+	}
+	if (!ParseHeader(WavData, OutInfo))
+	{
+		return false;
+	}
+	// Truncated files keep the samples they have
+	const auto PCMDataSize = FMath::Min<int64>(OutInfo.PCMDataSize, WavData.Num() - OutInfo.PCMDataOffset);
+	OutPCMData.SetNumUninitialized(PCMDataSize / sizeof(int16));
+	FMemory::Memcpy(OutPCMData.GetData(), WavData.GetData() + OutInfo.PCMDataOffset,
+					OutPCMData.Num() * sizeof(int16));
+	return true;
+}
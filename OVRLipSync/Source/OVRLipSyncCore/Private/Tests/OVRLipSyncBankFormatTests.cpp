@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncBankFormatTests.cpp
+ * Content     :   Automation tests of the sequence bank format
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "Misc/AutomationTest.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncBankFormat.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+struct FTestLine
+{
+	FString LineId;
+	TArray<float> Visemes;
+	TArray<float> LaughterScores;
+
+	FTestLine(const FString &InLineId, int32 NumFrames, float Score) : LineId(InLineId)
+	{
+		Visemes.Init(Score, NumFrames * OVRLipSyncVisemeCount);
+		LaughterScores.Init(Score, NumFrames);
+	}
+
+	FOVRLipSyncBankLine ToBankLine() const { return {LineId, Visemes, LaughterScores, 100.0f}; }
+};
+
+const FOVRLipSyncBankEntry *FindEntry(const uint8 *Data, const FString &LineId)
+{
+	const auto Hash = FOVRLipSyncBankFormat::HashLineId(LineId);
+	for (const auto &Entry : FOVRLipSyncBankFormat::GetEntries(Data))
+	{
+		if (Entry.Hash == Hash)
+		{
+			return &Entry;
+		}
+	}
+	return nullptr;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncBankFormatRoundTripTest, "OVRLipSync.Core.BankFormat.RoundTrip",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncBankFormatRoundTripTest::RunTest(const FString &Parameters)
+{
+	const FTestLine Lines[] = {{TEXT("npc/guard/Line01"), 3, 0.25f}, {TEXT("npc/merchant/line01"), 5, 0.75f}};
+	TArray<FOVRLipSyncBankLine> BankLines;
+	for (const auto &Line : Lines)
+	{
+		BankLines.Add(Line.ToBankLine());
+	}
+	TArray<uint8> Bytes;
+	if (!TestTrue(TEXT("Bank is written"), FOVRLipSyncBankFormat::Write(BankLines, Bytes)) ||
+		!TestTrue(TEXT("Bank validates"), FOVRLipSyncBankFormat::Validate(Bytes.GetData(), Bytes.Num())))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Entry count"), FOVRLipSyncBankFormat::GetHeader(Bytes.GetData()).NumEntries, 2u);
+	TestEqual(TEXT("Frame count"), FOVRLipSyncBankFormat::GetHeader(Bytes.GetData()).NumFrames, 8u);
+	TestEqual(TEXT("Line IDs are case insensitive"), FOVRLipSyncBankFormat::HashLineId(TEXT("NPC/Guard/line01")),
+			  FOVRLipSyncBankFormat::HashLineId(TEXT("npc/guard/Line01")));
+
+	for (const auto &Line : Lines)
+	{
+		const auto Entry = FindEntry(Bytes.GetData(), Line.LineId);
+		if (!TestNotNull(*FString::Printf(TEXT("Entry of %s"), *Line.LineId), Entry))
+		{
+			continue;
+		}
+		TestEqual(TEXT("Line frame count"), static_cast<int32>(Entry->NumFrames), Line.LaughterScores.Num());
+		TestEqual(TEXT("Line frame rate"), Entry->FrameRate, 100.0f);
+		const auto Visemes =
+			FOVRLipSyncBankFormat::GetVisemes(Bytes.GetData()) + Entry->FirstFrame * OVRLipSyncVisemeCount;
+		const auto LaughterScores = FOVRLipSyncBankFormat::GetLaughterScores(Bytes.GetData()) + Entry->FirstFrame;
+		TestTrue(TEXT("Line visemes"), FMemory::Memcmp(Visemes, Line.Visemes.GetData(),
+													   Line.Visemes.Num() * sizeof(float)) == 0);
+		TestTrue(TEXT("Line laughter scores"), FMemory::Memcmp(LaughterScores, Line.LaughterScores.GetData(),
+															   Line.LaughterScores.Num() * sizeof(float)) == 0);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncBankFormatInvalidTest, "OVRLipSync.Core.BankFormat.Invalid",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncBankFormatInvalidTest::RunTest(const FString &Parameters)
+{
+	{
+		const FTestLine First(TEXT("Line01"), 1, 0.0f), Second(TEXT("LINE01"), 1, 0.0f);
+		const FOVRLipSyncBankLine BankLines[] = {First.ToBankLine(), Second.ToBankLine()};
+		TArray<uint8> Bytes;
+		AddExpectedError(TEXT("are duplicates"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Duplicate line IDs are rejected"), FOVRLipSyncBankFormat::Write(BankLines, Bytes));
+	}
+	{
+		FTestLine Line(TEXT("Line01"), 2, 0.0f);
+		Line.LaughterScores.Pop();
+		const FOVRLipSyncBankLine BankLines[] = {Line.ToBankLine()};
+		TArray<uint8> Bytes;
+		AddExpectedError(TEXT("inconsistent"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Inconsistent frames are rejected"), FOVRLipSyncBankFormat::Write(BankLines, Bytes));
+	}
+
+	const FTestLine Lines[] = {{TEXT("Line01"), 2, 0.5f}, {TEXT("Line02"), 2, 0.5f}};
+	const FOVRLipSyncBankLine BankLines[] = {Lines[0].ToBankLine(), Lines[1].ToBankLine()};
+	TArray<uint8> Bytes;
+	if (!TestTrue(TEXT("Bank is written"), FOVRLipSyncBankFormat::Write(BankLines, Bytes)))
+	{
+		return false;
+	}
+	{
+		AddExpectedError(TEXT("truncated"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Truncated bank is rejected"),
+				  FOVRLipSyncBankFormat::Validate(Bytes.GetData(), Bytes.Num() - 1));
+	}
+	{
+		auto Corrupt = Bytes;
+		reinterpret_cast<FOVRLipSyncBankHeader *>(Corrupt.GetData())->Version = FOVRLipSyncBankFormat::Version - 1;
+		AddExpectedError(TEXT("Unsupported sequence bank format"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Old version is rejected"),
+				  FOVRLipSyncBankFormat::Validate(Corrupt.GetData(), Corrupt.Num()));
+	}
+	{
+		auto Corrupt = Bytes;
+		auto Entries = reinterpret_cast<FOVRLipSyncBankEntry *>(Corrupt.GetData() + sizeof(FOVRLipSyncBankHeader));
+		Entries[1].FirstFrame = 3;
+		AddExpectedError(TEXT("refers to frames"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Entry past the frames is rejected"),
+				  FOVRLipSyncBankFormat::Validate(Corrupt.GetData(), Corrupt.Num()));
+	}
+	{
+		auto Corrupt = Bytes;
+		auto Entries = reinterpret_cast<FOVRLipSyncBankEntry *>(Corrupt.GetData() + sizeof(FOVRLipSyncBankHeader));
+		Swap(Entries[0], Entries[1]);
+		AddExpectedError(TEXT("not sorted"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Unsorted entries are rejected"),
+				  FOVRLipSyncBankFormat::Validate(Corrupt.GetData(), Corrupt.Num()));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFrameCodecTests.cpp
+ * Content     :   Automation tests of frame encoding
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "Misc/AutomationTest.h"
+#include "OVRLipSyncAnalysis.h"
+#include "OVRLipSyncFrameCodec.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncFrameCodecQuantizeTest, "OVRLipSync.Core.FrameCodec.Quantize",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncFrameCodecQuantizeTest::RunTest(const FString &Parameters)
+{
+	TestEqual(TEXT("Zero"), FOVRLipSyncFrameCodec::Quantize(0.0f), static_cast<uint8>(0));
+	TestEqual(TEXT("One"), FOVRLipSyncFrameCodec::Quantize(1.0f), static_cast<uint8>(255));
+	TestEqual(TEXT("Below range clamps"), FOVRLipSyncFrameCodec::Quantize(-0.5f), static_cast<uint8>(0));
+	TestEqual(TEXT("Above range clamps"), FOVRLipSyncFrameCodec::Quantize(2.0f), static_cast<uint8>(255));
+	for (int32 Score = 0; Score < 256; ++Score)
+	{
+		const auto Value = static_cast<uint8>(Score);
+		if (FOVRLipSyncFrameCodec::Quantize(FOVRLipSyncFrameCodec::Dequantize(Value)) != Value)
+		{
+			AddError(FString::Printf(TEXT("Score %d doesn't round trip"), Score));
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncFrameCodecDecimateTest, "OVRLipSync.Core.FrameCodec.Decimate",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncFrameCodecDecimateTest::RunTest(const FString &Parameters)
+{
+	// Three frames of a single viseme stride decimated by two, the last block is shorter
+	constexpr auto VisemeCount = OVRLipSyncVisemeCount;
+	TArray<float> Visemes;
+	Visemes.AddZeroed(3 * VisemeCount);
+	Visemes[0] = 0.2f;
+	Visemes[VisemeCount] = 0.4f;
+	Visemes[2 * VisemeCount] = 1.0f;
+	const TArray<float> LaughterScores = {0.0f, 1.0f, 0.5f};
+	TArray<float> OutVisemes, OutLaughterScores;
+	FOVRLipSyncFrameCodec::Decimate(Visemes, LaughterScores, 2, OutVisemes, OutLaughterScores);
+	if (!TestEqual(TEXT("Frame count"), OutLaughterScores.Num(), 2) ||
+		!TestEqual(TEXT("Viseme count"), OutVisemes.Num(), 2 * VisemeCount))
+	{
+		return false;
+	}
+	TestEqual(TEXT("First block visemes"), OutVisemes[0], 0.3f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Last block visemes"), OutVisemes[VisemeCount], 1.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("First block laughter"), OutLaughterScores[0], 0.5f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Last block laughter"), OutLaughterScores[1], 0.5f, KINDA_SMALL_NUMBER);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncFrameCodecKeyframeTest, "OVRLipSync.Core.FrameCodec.Keyframes",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncFrameCodecKeyframeTest::RunTest(const FString &Parameters)
+{
+	constexpr int32 NumFrames = 600;
+	constexpr int32 Stride = 2;
+	constexpr float Tolerance = 0.02f;
+	// Two interleaved channels: a constant one beyond MaxKeyGap and a curve
+	TArray<float> Scores;
+	Scores.SetNumUninitialized(NumFrames * Stride);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Scores[Frame * Stride] = 0.5f;
+		Scores[Frame * Stride + 1] = 0.5f + 0.5f * FMath::Sin(Frame * 0.05f);
+	}
+
+	for (int32 Channel = 0; Channel < Stride; ++Channel)
+	{
+		TArray<uint8> KeyScores, KeyGaps;
+		const auto NumKeys = FOVRLipSyncFrameCodec::EncodeKeyframes(Scores.GetData() + Channel, NumFrames, Stride,
+																	Tolerance, KeyScores, KeyGaps);
+		TestEqual(TEXT("Keys are appended"), KeyScores.Num(), NumKeys);
+		TestTrue(TEXT("Keys are fewer than frames"), NumKeys < NumFrames);
+		if (Channel == 0)
+		{
+			TestEqual(TEXT("Constant channel keeps a key every MaxKeyGap frames"), NumKeys,
+					  FMath::DivideAndRoundUp(NumFrames - 1, FOVRLipSyncFrameCodec::MaxKeyGap) + 1);
+		}
+
+		TArray<float> Decoded;
+		Decoded.Init(-1.0f, NumFrames * Stride);
+		FOVRLipSyncFrameCodec::DecodeKeyframes(KeyScores.GetData(), KeyGaps.GetData(), NumKeys,
+											   Decoded.GetData() + Channel, Stride);
+		// Keys themselves are off by up to half a quantization step
+		const auto MaxError = Tolerance + 0.5f / 255.0f + KINDA_SMALL_NUMBER;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const auto Idx = Frame * Stride + Channel;
+			if (FMath::Abs(Decoded[Idx] - Scores[Idx]) > MaxError)
+			{
+				AddError(FString::Printf(TEXT("Channel %d frame %d decoded to %f instead of %f"), Channel, Frame,
+										 Decoded[Idx], Scores[Idx]));
+				break;
+			}
+		}
+	}
+
+	TArray<uint8> KeyScores, KeyGaps;
+	TestEqual(TEXT("Empty channel has no keys"),
+			  FOVRLipSyncFrameCodec::EncodeKeyframes(Scores.GetData(), 0, Stride, Tolerance, KeyScores, KeyGaps), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
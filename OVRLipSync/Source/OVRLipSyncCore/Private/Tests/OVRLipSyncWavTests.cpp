@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncWavTests.cpp
+ * Content     :   Automation tests of WAV parsing
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "Misc/AutomationTest.h"
+#include "OVRLipSyncWav.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+void AppendChunk(TArray<uint8> &Wav, const char *Id, uint32 Size)
+{
+	Wav.Append(reinterpret_cast<const uint8 *>(Id), 4);
+	Wav.Append(reinterpret_cast<const uint8 *>(&Size), sizeof(Size));
+}
+
+template <typename T> void AppendValue(TArray<uint8> &Wav, T Value)
+{
+	Wav.Append(reinterpret_cast<const uint8 *>(&Value), sizeof(Value));
+}
+
+// RIFF header and a fmt chunk of FmtSize bytes, RIFF size is left for the tests to ignore
+TArray<uint8> MakeWavHeader(uint16 NumChannels, uint32 SampleRate, uint32 FmtSize = 16, uint16 BitsPerSample = 16)
+{
+	TArray<uint8> Wav;
+	AppendChunk(Wav, "RIFF", 0);
+	Wav.Append(reinterpret_cast<const uint8 *>("WAVE"), 4);
+	AppendChunk(Wav, "fmt ", FmtSize);
+	AppendValue<uint16>(Wav, 1);
+	AppendValue<uint16>(Wav, NumChannels);
+	AppendValue<uint32>(Wav, SampleRate);
+	AppendValue<uint32>(Wav, SampleRate * NumChannels * BitsPerSample / 8);
+	AppendValue<uint16>(Wav, NumChannels * BitsPerSample / 8);
+	AppendValue<uint16>(Wav, BitsPerSample);
+	Wav.AddZeroed(FmtSize - 16);
+	return Wav;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOVRLipSyncWavParseTest, "OVRLipSync.Core.Wav.Parse",
+								 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FOVRLipSyncWavParseTest::RunTest(const FString &Parameters)
+{
+	{
+		auto Wav = MakeWavHeader(2, 48000);
+		AppendChunk(Wav, "data", 8);
+		Wav.AddZeroed(8);
+		FOVRLipSyncWavInfo Info;
+		TestTrue(TEXT("Plain file parses"), FOVRLipSyncWav::ParseHeader(Wav, Info));
+		TestEqual(TEXT("Sample rate"), Info.SampleRate, 48000u);
+		TestEqual(TEXT("Channels"), Info.NumChannels, static_cast<uint16>(2));
+		TestEqual(TEXT("Data offset"), Info.PCMDataOffset, 44u);
+		TestEqual(TEXT("Data size"), Info.PCMDataSize, 8u);
+	}
+	{
+		// Extended fmt chunk followed by an odd sized chunk and its pad byte
+		auto Wav = MakeWavHeader(1, 16000, 18);
+		AppendChunk(Wav, "LIST", 3);
+		Wav.AddZeroed(4);
+		AppendChunk(Wav, "data", 4);
+		Wav.AddZeroed(4);
+		FOVRLipSyncWavInfo Info;
+		TestTrue(TEXT("Extended file parses"), FOVRLipSyncWav::ParseHeader(Wav, Info));
+		TestEqual(TEXT("Data offset skips pad byte"), Info.PCMDataOffset, static_cast<uint32>(Wav.Num() - 4));
+		TestEqual(TEXT("Sample rate"), Info.SampleRate, 16000u);
+	}
+	{
+		// A chunk size near 4GB used to wrap the offset around and loop forever
+		auto Wav = MakeWavHeader(1, 16000);
+		AppendChunk(Wav, "junk", 0xFFFFFFF8u);
+		AppendChunk(Wav, "data", 4);
+		Wav.AddZeroed(4);
+		FOVRLipSyncWavInfo Info;
+		AddExpectedError(TEXT("data chunk not found"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Oversized chunk is rejected"), FOVRLipSyncWav::ParseHeader(Wav, Info));
+	}
+	{
+		auto Wav = MakeWavHeader(1, 16000, 16, 8);
+		AppendChunk(Wav, "data", 4);
+		Wav.AddZeroed(4);
+		FOVRLipSyncWavInfo Info;
+		AddExpectedError(TEXT("Unsupported bits per sample"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("8-bit audio is rejected"), FOVRLipSyncWav::ParseHeader(Wav, Info));
+	}
+	{
+		TArray<uint8> Wav;
+		AppendChunk(Wav, "RIFX", 0);
+		Wav.Append(reinterpret_cast<const uint8 *>("WAVE"), 4);
+		AppendChunk(Wav, "data", 0);
+		FOVRLipSyncWavInfo Info;
+		AddExpectedError(TEXT("Invalid WAV header"), EAutomationExpectedErrorFlags::Contains);
+		TestFalse(TEXT("Non RIFF data is rejected"), FOVRLipSyncWav::ParseHeader(Wav, Info));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncAnalysis.h
+ * Content     :   Prototypes for OVRLipSync chunked audio analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OVRLipSync.h"
+
+class UOVRLipSyncContextWrapper;
+
+// Scores per frame: sil, PP, FF, TH, DD, kk, CH, SS, nn, RR, aa, E, ih, oh, ou
+constexpr int32 OVRLipSyncVisemeCount = 15;
+
+// Produces LipSync scores for chunks of interleaved 16-bit audio
+class OVRLIPSYNCCORE_API IOVRLipSyncAnalyzer
+{
+public:
+	virtual ~IOVRLipSyncAnalyzer() = default;
+
+	// Creates analyzer by name: "Context" runs the SDK, "Energy" is the stand-in analyzer.
+	// Returns null if the analyzer isn't available on this platform.
+	static TUniquePtr<IOVRLipSyncAnalyzer> Create(const FString &Name, int32 SampleRate,
+												  ovrLipSyncContextProvider Provider = ovrLipSyncContextProvider_Enhanced);
+
+	// The SDK analyzer when the platform has its binaries
+	static const TCHAR *GetDefaultName() { return WITH_OVRLIPSYNC_SDK ? TEXT("Context") : TEXT("Energy"); }
+
+	// Analyses NumSamples samples of every channel. OutVisemes holds OVRLipSyncVisemeCount scores,
+	// OutFrameDelayMs is the latency of the analyzer.
+	virtual void Analyze(const int16 *Chunk, int32 NumSamples, bool bStereo, float *OutVisemes,
+						 float &OutLaughterScore, int32 &OutFrameDelayMs) = 0;
+
+	// Drops state left by previous audio
+	virtual void Reset() = 0;
+};
+
+struct FOVRLipSyncAnalysisSettings
+{
+	int32 SampleRate = 48000;
+	int32 NumChannels = 1;
+	// Time between consecutive frames
+	float HopMs = 10.0f;
+	// Amount of audio analysed per frame, shorter windows skip the rest of the hop. Clamped to HopMs.
+	float WindowMs = 10.0f;
+};
+
+// Splits 16-bit PCM data into hops, feeds them to an analyzer and compensates its frame delay.
+// Analyzer state is reset between Generate calls, so results only depend on the audio passed in.
+class OVRLIPSYNCCORE_API FOVRLipSyncChunkedAnalysis
+{
+public:
+	// Receives progress in [0, 1] range, returning false cancels generation
+	using FProgressCallback = TFunctionRef<bool(float Progress)>;
+
+	// Analyzer has to outlive the analysis
+	FOVRLipSyncChunkedAnalysis(IOVRLipSyncAnalyzer &InAnalyzer, const FOVRLipSyncAnalysisSettings &InSettings);
+
+	// Appends scores of every frame for interleaved PCMData (NumSamples counts samples of all channels):
+	// OVRLipSyncVisemeCount scores per frame to OutVisemes and one to OutLaughterScores.
+	// Returns false if generation was cancelled, frames produced so far are kept.
+	bool Generate(const int16 *PCMData, int32 NumSamples, TArray<float> &OutVisemes,
+				  TArray<float> &OutLaughterScores, FProgressCallback Progress);
+
+	// Number of frames Generate will produce for NumSamples interleaved samples
+	int32 GetNumFrames(int32 NumSamples) const;
+
+	// Number of frames per second
+	float GetFrameRate() const;
+
+	const FOVRLipSyncAnalysisSettings &GetSettings() const { return Settings; }
+
+private:
+	void ProcessChunk(const int16 *Chunk);
+
+	IOVRLipSyncAnalyzer &Analyzer;
+	FOVRLipSyncAnalysisSettings Settings;
+	bool bAnalyzerDirty = false;
+
+	// Samples analysed per frame, per channel and for all channels
+	int32 ChunkSizeSamples = 0;
+	int32 ChunkSize = 0;
+	// Samples between consecutive frames, for all channels
+	int32 HopSize = 0;
+	// Number of leading interleaved samples to drop to compensate analyzer frame delay
+	int32 FrameOffset = 0;
+
+	// Scratch buffers reused between chunks and Generate calls
+	TArray<int16> PaddedChunk;
+	float Visemes[OVRLipSyncVisemeCount] = {};
+	float LaughterScore = 0.0f;
+	int32 FrameDelayInMs = 0;
+};
+
+#if WITH_OVRLIPSYNC_SDK
+// Analyzer running a LipSync SDK context
+class OVRLIPSYNCCORE_API FOVRLipSyncContextAnalyzer : public IOVRLipSyncAnalyzer
+{
+public:
+	FOVRLipSyncContextAnalyzer(ovrLipSyncContextProvider Provider, int32 SampleRate, int32 BufferSize,
+							   const FString &ModelPath, bool bEnableAcceleration);
+	virtual ~FOVRLipSyncContextAnalyzer() override;
+
+	virtual void Analyze(const int16 *Chunk, int32 NumSamples, bool bStereo, float *OutVisemes,
+						 float &OutLaughterScore, int32 &OutFrameDelayMs) override;
+	virtual void Reset() override;
+
+private:
+	TUniquePtr<UOVRLipSyncContextWrapper> Context;
+	TArray<float> ContextVisemes;
+};
+#endif
+
+// Maps loudness of every chunk to the silence and aa visemes. Stands in for the SDK on platforms without
+// its binaries, so everything around analysis could be tested and benchmarked there.
+class OVRLIPSYNCCORE_API FOVRLipSyncEnergyAnalyzer : public IOVRLipSyncAnalyzer
+{
+public:
+	virtual void Analyze(const int16 *Chunk, int32 NumSamples, bool bStereo, float *OutVisemes,
+						 float &OutLaughterScore, int32 &OutFrameDelayMs) override;
+	virtual void Reset() override {}
+};
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncBankFormat.h
+ * Content     :   Prototypes for OVRLipSync sequence bank format
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Bank layout: header, entries sorted by line ID hash, visemes of all lines, laughter scores of all lines
+struct FOVRLipSyncBankHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 NumEntries;
+	uint32 NumFrames;
+};
+
+struct FOVRLipSyncBankEntry
+{
+	uint64 Hash;
+	uint32 FirstFrame;
+	uint32 NumFrames;
+	float FrameRate;
+	uint32 Padding;
+};
+
+static_assert(sizeof(FOVRLipSyncBankHeader) % alignof(float) == 0 && sizeof(FOVRLipSyncBankEntry) % alignof(float) == 0,
+			  "Frame data must stay aligned");
+
+// Frames of a line written into a bank
+struct FOVRLipSyncBankLine
+{
+	FString LineId;
+	TArrayView<const float> Visemes;
+	TArrayView<const float> LaughterScores;
+	float FrameRate = 100.0f;
+};
+
+class OVRLIPSYNCCORE_API FOVRLipSyncBankFormat
+{
+public:
+	static constexpr uint32 Magic = 0x42534C4F; // "OLSB"
+	// Version 2 widened line ID hashes to 64 bits
+	static constexpr uint32 Version = 2;
+
+	// Case insensitive, hashed as UTF-8 so banks match across platforms
+	static uint64 HashLineId(const FString &LineId);
+
+	// Serializes lines into OutBytes, fails on duplicate or colliding line IDs
+	static bool Write(TArrayView<const FOVRLipSyncBankLine> Lines, TArray<uint8> &OutBytes);
+
+	// Checks header, size and entries of bank data, entries and frames could be read in place once it passes
+	static bool Validate(const uint8 *Data, int64 DataSize);
+
+	static const FOVRLipSyncBankHeader &GetHeader(const uint8 *Data)
+	{
+		return *reinterpret_cast<const FOVRLipSyncBankHeader *>(Data);
+	}
+	static TArrayView<const FOVRLipSyncBankEntry> GetEntries(const uint8 *Data)
+	{
+		return MakeArrayView(reinterpret_cast<const FOVRLipSyncBankEntry *>(Data + sizeof(FOVRLipSyncBankHeader)),
+							 GetHeader(Data).NumEntries);
+	}
+	static const float *GetVisemes(const uint8 *Data);
+	static const float *GetLaughterScores(const uint8 *Data);
+};
@@ -25,7 +25,11 @@
 #include "CoreMinimal.h"
 #include "OVRLipSync.h"
 
-class OVRLIPSYNC_API UOVRLipSyncContextWrapper
+class IOVRLipSyncAnalyzer;
+
+// Runs the SDK when WITH_OVRLIPSYNC_SDK is set. Other platforms have no SDK binaries, contexts there run the
+// Energy stand-in analyzer synchronously, so the live path still works e.g. on headless Linux.
+class OVRLIPSYNCCORE_API UOVRLipSyncContextWrapper
 {
 public:
 	UOVRLipSyncContextWrapper(ovrLipSyncContextProvider Provider, int SampleRate = 48000, int BufferSize = 4096,
@@ -34,14 +38,33 @@ public:
 
 	void ProcessFrame(const int16_t *Data, int DataSize, TArray<float> &Visemes, float &LaughterScore,
 					  int32_t &FrameDelay, bool Stereo = false);
+	void ProcessFrame(const float *Data, int DataSize, TArray<float> &Visemes, float &LaughterScore,
+					  int32_t &FrameDelay, bool Stereo = false);
+
+	// Clears internal state so the context could be reused for an unrelated audio stream
+	void Reset();
 
-	// Async processing
-	using AsyncCallbackType = TFunction<void(const TArray<float> &Visemes, float LaughterScore)>;
+	// Directory the SDK library is loaded from, defaults to the plugin ThirdParty directory.
+	// Programs that don't run from a project set it before creating contexts.
+	static void SetLibraryDirectory(const FString &Directory);
+
+	// Async processing, SubmitTime is when the audio of the prediction was passed to ProcessFrameAsync
+	using AsyncCallbackType = TFunction<void(const TArray<float> &Visemes, float LaughterScore, double SubmitTime)>;
 	void SetAsyncCallback(const AsyncCallbackType &AsyncCallback);
-	void InvokeAsyncCallback(const TArray<float> &Visemes, float LaughterScore);
+	void InvokeAsyncCallback(const TArray<float> &Visemes, float LaughterScore, double SubmitTime);
 	void ProcessFrameAsync(const int16_t *Data, int DataSize, bool Stereo = false);
+	void ProcessFrameAsync(const float *Data, int DataSize, bool Stereo = false);
 
 private:
+	void ProcessFrameAsync(const void *Data, int DataSize, ovrLipSyncAudioDataType DataType);
+	void ProcessFrame(const void *Data, int DataSize, ovrLipSyncAudioDataType DataType, TArray<float> &Visemes,
+					  float &LaughterScore, int32_t &FrameDelay);
+
+	static FString LibraryDirectory;
+
 	AsyncCallbackType AsyncCallback;
 	ovrLipSyncContext LipSyncContext = 0;
+	// Only set without the SDK
+	TUniquePtr<IOVRLipSyncAnalyzer> StandInAnalyzer;
+	TArray<int16> StandInSamples;
 };
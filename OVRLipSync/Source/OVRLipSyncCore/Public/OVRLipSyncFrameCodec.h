@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncFrameCodec.h
+ * Content     :   Prototypes for OVRLipSync frame encoding
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Encoding primitives for LipSync frames. Frames are laid out as in sequences: OVRLipSyncVisemeCount
+// viseme scores per frame in one array and a laughter score per frame in another.
+class OVRLIPSYNCCORE_API FOVRLipSyncFrameCodec
+{
+public:
+	// Keys are at most this many frames apart, so gaps fit in a byte
+	static constexpr int32 MaxKeyGap = 255;
+
+	static uint8 Quantize(float Score)
+	{
+		return static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Score * 255.0f), 0, 255));
+	}
+	static float Dequantize(uint8 Score) { return Score / 255.0f; }
+
+	// Averages blocks of Factor frames into OutVisemes and OutLaughterScores, the last block may be shorter
+	static void Decimate(TArrayView<const float> Visemes, TArrayView<const float> LaughterScores, int32 Factor,
+						 TArray<float> &OutVisemes, TArray<float> &OutLaughterScores);
+
+	// Appends keys of a single channel, NumFrames scores Stride apart, to OutKeyScores and OutKeyGaps.
+	// Linear interpolation between quantized keys stays within Tolerance of every score. Returns number of keys.
+	static int32 EncodeKeyframes(const float *Scores, int32 NumFrames, int32 Stride, float Tolerance,
+								 TArray<uint8> &OutKeyScores, TArray<uint8> &OutKeyGaps);
+
+	// Writes scores of a channel encoded by EncodeKeyframes, Stride apart
+	static void DecodeKeyframes(const uint8 *KeyScores, const uint8 *KeyGaps, int32 NumKeys, float *OutScores,
+								int32 Stride);
+};
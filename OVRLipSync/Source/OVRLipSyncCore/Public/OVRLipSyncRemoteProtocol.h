@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncRemoteProtocol.h
+ * Content     :   Records of OVRLipSync out-of-process live analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OVRLipSyncAnalysis.h"
+
+// Live audio is written to an audio ring, analysed by the helper process ("OVRLipSyncCli -Remote=<Name>")
+// and its frames come back through a frame ring. The game creates both rings, the helper opens them.
+class FOVRLipSyncRemoteProtocol
+{
+public:
+	// About 10 seconds of 48 kHz mono audio
+	static constexpr uint32 AudioRingCapacity = 1024 * 1024;
+	static constexpr uint32 FrameRingCapacity = 256 * 1024;
+
+	static FString GetAudioRingName(const FString &Name) { return Name + TEXT("_Audio"); }
+	static FString GetFrameRingName(const FString &Name) { return Name + TEXT("_Frames"); }
+};
+
+// Followed by interleaved 16-bit samples
+struct FOVRLipSyncRemoteAudio
+{
+	uint64 Sequence = 0;
+	// Echoed back in the frame, only meaningful to the game process
+	double SubmitTime = 0.0;
+	uint32 SampleRate = 0;
+	uint32 NumChannels = 0;
+};
+
+struct FOVRLipSyncRemoteFrame
+{
+	uint64 Sequence = 0;
+	double SubmitTime = 0.0;
+	float Visemes[OVRLipSyncVisemeCount] = {};
+	float LaughterScore = 0.0f;
+	int32 FrameDelayMs = 0;
+	// Time the helper spent analysing the audio
+	float AnalysisMs = 0.0f;
+};
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncServiceProtocol.h
+ * Content     :   Messages of the OVRLipSync generation service
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Generation service messages, exchanged over a local TCP connection in native byte order.
+// Clients may pipeline requests, every request is answered by a response with the same RequestId
+// and responses may arrive out of order.
+class FOVRLipSyncServiceProtocol
+{
+public:
+	static constexpr uint32 RequestMagic = 0x514C4C4F;	// "OLLQ"
+	static constexpr uint32 ResponseMagic = 0x504C4C4F; // "OLLP"
+	static constexpr int32 DefaultPort = 7797;
+	// Requests with larger payloads are rejected and the connection is closed
+	static constexpr uint32 MaxPayloadSize = 64 * 1024 * 1024;
+
+	enum class Payload : uint16
+	{
+		// Interleaved 16-bit samples, format is given by the request
+		PCM16,
+		// Complete WAV file, format is read from its header
+		Wav
+	};
+
+	enum class Status : uint32
+	{
+		Ok,
+		InvalidRequest,
+		AnalysisFailed
+	};
+};
+
+struct FOVRLipSyncServiceRequest
+{
+	uint32 Magic = FOVRLipSyncServiceProtocol::RequestMagic;
+	uint32 RequestId = 0;
+	uint32 SampleRate = 0;
+	uint16 NumChannels = 0;
+	FOVRLipSyncServiceProtocol::Payload PayloadType = FOVRLipSyncServiceProtocol::Payload::PCM16;
+	uint32 PayloadSize = 0;
+};
+
+// Followed by quantized scores: visemes of all frames, then laughter scores of all frames
+struct FOVRLipSyncServiceResponse
+{
+	uint32 Magic = FOVRLipSyncServiceProtocol::ResponseMagic;
+	uint32 RequestId = 0;
+	FOVRLipSyncServiceProtocol::Status Status = FOVRLipSyncServiceProtocol::Status::Ok;
+	uint32 NumFrames = 0;
+	float FrameRate = 0.0f;
+	uint32 PayloadSize = 0;
+};
+
+static_assert(sizeof(FOVRLipSyncServiceRequest) == 20 && sizeof(FOVRLipSyncServiceResponse) == 24,
+			  "Service messages must not contain padding");
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSharedRing.h
+ * Content     :   Prototypes for OVRLipSync shared memory ring buffer
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+
+// Single producer, single consumer ring of variable sized records in a named shared memory region, so two
+// processes could exchange audio and frames without system calls. Records are published whole, a producer
+// dying mid-write leaves the ring consistent and a restarted producer continues where it stopped.
+class OVRLIPSYNCCORE_API FOVRLipSyncSharedRing
+{
+public:
+	FOVRLipSyncSharedRing() = default;
+	~FOVRLipSyncSharedRing();
+
+	FOVRLipSyncSharedRing(const FOVRLipSyncSharedRing &) = delete;
+	FOVRLipSyncSharedRing &operator=(const FOVRLipSyncSharedRing &) = delete;
+
+	// Creates the region, Capacity is rounded up to a multiple of the record alignment
+	bool Create(const FString &Name, uint32 Capacity);
+
+	// Opens a region created by another process
+	bool Open(const FString &Name);
+
+	// Unmaps the region, marking it closed if this side created it
+	void Close();
+
+	bool IsValid() const { return Header != nullptr; }
+
+	// True once the creating side closed the ring, tells the other process to exit
+	bool IsClosed() const;
+
+	// Appends a record made of Header followed by Payload, returns false if there is no room for it
+	bool Write(const void *RecordHeader, uint32 HeaderSize, const void *Payload = nullptr, uint32 PayloadSize = 0);
+
+	// Reads the oldest record into OutRecord, returns false if the ring is empty
+	bool Read(TArray<uint8> &OutRecord);
+
+	// Drops every record waiting in the ring. Consumer side operation, the creating side may only call it
+	// while no consumer is attached.
+	void Discard();
+
+	// Total bytes written and read, the difference is the amount of data waiting in the ring
+	uint64 GetWriteOffset() const;
+	uint64 GetReadOffset() const;
+
+private:
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Capacity;
+		TAtomic<uint32> bClosed;
+		uint32 Padding;
+		// Written by the producer and the consumer only, each on its own cache line
+		alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint64> WriteOffset;
+		alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint64> ReadOffset;
+	};
+
+	bool Map(const FString &Name, uint32 Capacity, bool bCreate);
+	void CopyIn(uint64 Offset, const void *Source, uint32 Size);
+	void CopyOut(uint64 Offset, void *Dest, uint32 Size) const;
+
+	FPlatformMemory::FSharedMemoryRegion *Region = nullptr;
+	FHeader *Header = nullptr;
+	uint8 *Data = nullptr;
+	bool bCreated = false;
+};
@@ -0,0 +1,46 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncWav.h
+ * Content     :   Prototypes for OVRLipSync WAV parsing
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FOVRLipSyncWavInfo
+{
+	uint32 SampleRate = 0;
+	uint16 NumChannels = 0;
+	// Location of interleaved 16-bit samples in the file, the size is the declared one and exceeds the
+	// data of truncated files
+	uint32 PCMDataOffset = 0;
+	uint32 PCMDataSize = 0;
+};
+
+// WAV file parsing, only 16-bit PCM is supported
+class OVRLIPSYNCCORE_API FOVRLipSyncWav
+{
+public:
+	static bool ParseHeader(TArrayView<const uint8> WavData, FOVRLipSyncWavInfo &OutInfo);
+
+	// Reads samples of a WAV file into OutPCMData
+	static bool LoadFile(const FString &FilePath, TArray<int16> &OutPCMData, FOVRLipSyncWavInfo &OutInfo);
+};
@@ -37,6 +37,7 @@ public class OVRLipSyncEditor : ModuleRules
           "OVRLipSync",
           "Slate",
           "SlateCore",
+          "UnrealEd",
           "AndroidPermission",
           "Voice"
         });
@@ -23,171 +23,27 @@
 #include "ContentBrowserModule.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "AudioDecompress.h"
-#include "AudioDevice.h"
-#include "Sound/SoundWave.h"
 #include "Engine.h"
 #include "Framework/Commands/UIAction.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Misc/EngineVersionComparison.h"
-#include "Misc/ScopedSlowTask.h"
 #include "Modules/ModuleManager.h"
-#include "OVRLipSyncContextWrapper.h"
 #include "OVRLipSyncFrame.h"
+#include "OVRLipSyncGenerationBatch.h"
+#include "OVRLipSyncSequenceBank.h"
 #include "Textures/SlateIcon.h"
 
 namespace
 {
 
-// Compute LipSync sequence frames at 100 times a second rate
-constexpr auto LipSyncSequenceUpateFrequency = 100;
-constexpr auto LipSyncSequenceDuration = 1.0f / LipSyncSequenceUpateFrequency;
-
-// Decompresses SoundWave object by initializing RawPCM data
-bool DecompressSoundWave(USoundWave* SoundWave)
-{
-	if (!SoundWave)
-		return false;
-
-	// Already have PCM
-	if (SoundWave->RawPCMData && SoundWave->RawPCMDataSize > 0)
-		return true;
-
-#if WITH_EDITOR
-	// Editor-only: pull PCM from the imported asset
-	TArray<uint8> ImportedPCM;
-	uint32 SampleRate = 0;
-	uint16 NumChannels = 0;
-
-	if (SoundWave->GetImportedSoundWaveData(ImportedPCM, SampleRate, NumChannels))
-	{
-		// Allocate and copy into RawPCMData so the rest of your code works unchanged
-		SoundWave->RawPCMDataSize = ImportedPCM.Num();
-		SoundWave->RawPCMData = static_cast<uint8*>(FMemory::Malloc(SoundWave->RawPCMDataSize));
-		FMemory::Memcpy(SoundWave->RawPCMData, ImportedPCM.GetData(), SoundWave->RawPCMDataSize);
-
-		// Make sure metadata matches
-		SoundWave->NumChannels = NumChannels;
-		SoundWave->SetSampleRate(SampleRate, /*bFromDecoders=*/true);
-
-		return true;
-	}
-#endif
-
-	UE_LOG(LogTemp, Error, TEXT("Failed to get imported PCM data for %s"), *SoundWave->GetName());
-	return false;
-}
-
-bool OVRLipSyncProcessSoundWave(const FAssetData &SoundWaveAsset, bool UseOfflineModel = false)
-{
-	auto ObjectPath = SoundWaveAsset.GetObjectPathString();
-	USoundWave* SoundWave = LoadObject<USoundWave>(nullptr, *ObjectPath);
-	if (!SoundWave)
-	{
-		UE_LOG(LogTemp, Error, TEXT("Can't find %s"), *ObjectPath);
-		return false;
-	}
-
-	if (SoundWave->NumChannels > 2)
-	{
-		UE_LOG(LogTemp, Error, TEXT("Can't process %s: only mono and stereo streams are supported"), *ObjectPath);
-		return false;
-	}
-
-	// Attempt to decompress/init PCM data
-	if (!DecompressSoundWave(SoundWave))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to decompress SoundWave %s"), *ObjectPath);
-		return false;
-	}
-
-	// Defensive checks: make sure RawPCMData is present and sized
-	if (SoundWave->RawPCMData == nullptr || SoundWave->RawPCMDataSize <= 0)
-	{
-		UE_LOG(LogTemp, Error, TEXT("SoundWave %s has no RawPCMData after decompression"), *ObjectPath);
-		return false;
-	}
-
-	auto SequenceName = FString::Printf(TEXT("%s_LipSyncSequence"), *SoundWaveAsset.AssetName.ToString());
-	auto SequencePath = FString::Printf(TEXT("%s_LipSyncSequence"), *SoundWaveAsset.PackageName.ToString());
-	auto SequencePackage = CreatePackage(*SequencePath);
-	auto Sequence = NewObject<UOVRLipSyncFrameSequence>(SequencePackage, *SequenceName, RF_Public | RF_Standalone);
-
-	auto NumChannels = SoundWave->NumChannels;
-	auto SampleRate = SoundWave->GetSampleRateForCurrentPlatform();
-	auto PCMDataSize = SoundWave->RawPCMDataSize / sizeof(int16_t);
-	auto PCMData = reinterpret_cast<int16_t *>(SoundWave->RawPCMData);
-	auto ChunkSizeSamples = static_cast<int>(SampleRate * LipSyncSequenceDuration);
-	auto ChunkSize = NumChannels * ChunkSizeSamples;
-
-	FString ModelPath = UseOfflineModel ? FPaths::Combine(FPaths::ProjectPluginsDir(), TEXT("OVRLipSync"),
-														  TEXT("OfflineModel"), TEXT("ovrlipsync_offline_model.pb"))
-										: FString();
-	UOVRLipSyncContextWrapper context(ovrLipSyncContextProvider_Enhanced, SampleRate, 4096, ModelPath);
-
-	float LaughterScore = 0.0f;
-	int32_t FrameDelayInMs = 0;
-	TArray<float> Visemes;
-
-	TArray<int16_t> samples;
-	samples.SetNumZeroed(ChunkSize);
-	context.ProcessFrame(samples.GetData(), ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs, NumChannels > 1);
-
-	int FrameOffset = (int)(FrameDelayInMs * SampleRate / 1000 * NumChannels);
-
-	FScopedSlowTask SlowTask(PCMDataSize + FrameOffset,
-							 FText::Format(NSLOCTEXT("NSLT_OVRLipSyncPlugin", "GeneratingLipSyncSequence",
-													 "Generating LipSync sequence for {0}..."),
-										   FText::FromName(SoundWaveAsset.AssetName)));
-	SlowTask.MakeDialog();
-	for (int offs = 0; offs < PCMDataSize + FrameOffset; offs += ChunkSize)
-	{
-		int remainingSamples = PCMDataSize - offs;
-		if (remainingSamples >= ChunkSize)
-		{
-			context.ProcessFrame(PCMData + offs, ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs,
-								 NumChannels > 1);
-		}
-		else
-		{
-			if (remainingSamples > 0)
-			{
-				memcpy(samples.GetData(), PCMData + offs, sizeof(int16_t) * remainingSamples);
-				memset(samples.GetData() + remainingSamples, 0, ChunkSize - remainingSamples);
-			}
-			else
-			{
-				memset(samples.GetData(), 0, ChunkSize);
-			}
-			context.ProcessFrame(samples.GetData(), ChunkSizeSamples, Visemes, LaughterScore, FrameDelayInMs,
-								 NumChannels > 1);
-		}
-
-		SlowTask.EnterProgressFrame(ChunkSize);
-		if (SlowTask.ShouldCancel())
-		{
-			return false;
-		}
-		if (offs >= FrameOffset)
-		{
-			Sequence->Add(Visemes, LaughterScore);
-		}
-	}
-
-	FAssetRegistryModule::AssetCreated(Sequence);
-	Sequence->MarkPackageDirty();
-	return true;
-}
-
 void OVRLipSyncCreateSequence(const TArray<FAssetData> SelectedSoundAssets, bool UseOfflineModel = false)
 {
+	TArray<FSoftObjectPath> SoundWaves;
 	for (auto &SoundWaveAsset : SelectedSoundAssets)
 	{
-		if (!OVRLipSyncProcessSoundWave(SoundWaveAsset, UseOfflineModel))
-		{
-			break;
-		}
+		SoundWaves.Emplace(SoundWaveAsset.GetObjectPathString());
 	}
+	FOVRLipSyncGenerationBatch::Start(SoundWaves, UseOfflineModel);
 }
 
 void OVRLipSyncContextMenuExtension(FMenuBuilder &MenuBuilder, const TArray<FAssetData> SelectedSoundWavesPath)
@@ -205,18 +61,68 @@ void OVRLipSyncContextMenuExtension(FMenuBuilder &MenuBuilder, const TArray<FAss
 		NSLOCTEXT("NSLT_OVRLipSyncPlugin", "CreateLipSyncSequenceWithOfflineModel_Tooltip",
 				  "Creates sequence asset that could be used by OVRLipSyncPlaybackActorComponent"),
 		FSlateIcon(), FUIAction(FExecuteAction::CreateStatic(OVRLipSyncCreateSequence, SelectedSoundWavesPath, true)));
+	if (FOVRLipSyncGenerationBatch::CanResume())
+	{
+		MenuBuilder.AddMenuEntry(
+			NSLOCTEXT("NSLT_OVRLipSyncPlugin", "ResumeLipSyncGeneration_Menu", "Resume LipSyncSequence Generation"),
+			NSLOCTEXT("NSLT_OVRLipSyncPlugin", "ResumeLipSyncGeneration_Tooltip",
+					  "Continues the cancelled or interrupted generation batch where it stopped"),
+			FSlateIcon(), FUIAction(FExecuteAction::CreateStatic(FOVRLipSyncGenerationBatch::Resume)));
+	}
+}
+
+// Packs selected sequences into a bank file named after their folder, using SoundWave names as line IDs
+void OVRLipSyncBuildSequenceBank(const TArray<FAssetData> SelectedSequenceAssets)
+{
+	TArray<FString> LineIds;
+	TArray<UOVRLipSyncFrameSequence *> Sequences;
+	for (auto &SequenceAsset : SelectedSequenceAssets)
+	{
+		auto Sequence = Cast<UOVRLipSyncFrameSequence>(SequenceAsset.GetAsset());
+		if (!Sequence)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't load %s"), *SequenceAsset.GetObjectPathString());
+			return;
+		}
+		auto LineId = SequenceAsset.AssetName.ToString();
+		LineId.RemoveFromEnd(TEXT("_LipSyncSequence"));
+		LineIds.Add(LineId);
+		Sequences.Add(Sequence);
+	}
+
+	auto BankName = FPaths::GetCleanFilename(SelectedSequenceAssets[0].PackagePath.ToString());
+	auto BankPath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("LipSyncBanks"), BankName + TEXT(".lsbank"));
+	if (UOVRLipSyncSequenceBank::SaveBank(BankPath, LineIds, Sequences))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Saved %d sequences to %s"), Sequences.Num(), *BankPath);
+	}
+}
+
+void OVRLipSyncSequenceContextMenuExtension(FMenuBuilder &MenuBuilder, const TArray<FAssetData> SelectedSequences)
+{
+	MenuBuilder.AddMenuEntry(
+		NSLOCTEXT("NSLT_OVRLipSyncPlugin", "BuildLipSyncSequenceBank_Menu", "Build LipSync Sequence Bank"),
+		NSLOCTEXT("NSLT_OVRLipSyncPlugin", "BuildLipSyncSequenceBank_Tooltip",
+				  "Packs selected sequences into Content/LipSyncBanks, add that directory to "
+				  "Additional Non-Asset Directories to Package to ship it"),
+		FSlateIcon(), FUIAction(FExecuteAction::CreateStatic(OVRLipSyncBuildSequenceBank, SelectedSequences)));
 }
 
 TSharedRef<FExtender> OVRLipSyncContextMenuExtender(const TArray<FAssetData> &SelectedAssets)
 {
 	TSharedRef<FExtender> Extender(new FExtender());
 	TArray<FAssetData> SelectedSoundWaveAssets;
+	TArray<FAssetData> SelectedSequenceAssets;
 	for (auto &Asset : SelectedAssets)
 	{
 		if (Asset.AssetClassPath.ToString().Contains(TEXT("SoundWave")))
 		{
 			SelectedSoundWaveAssets.Add(Asset);
 		}
+		else if (Asset.AssetClassPath == UOVRLipSyncFrameSequence::StaticClass()->GetClassPathName())
+		{
+			SelectedSequenceAssets.Add(Asset);
+		}
 	}
 	if (SelectedSoundWaveAssets.Num() > 0)
 	{
@@ -224,6 +130,12 @@ TSharedRef<FExtender> OVRLipSyncContextMenuExtender(const TArray<FAssetData> &Se
 			"GetAssetActions", EExtensionHook::After, TSharedPtr<FUICommandList>(),
 			FMenuExtensionDelegate::CreateStatic(OVRLipSyncContextMenuExtension, SelectedSoundWaveAssets));
 	}
+	if (SelectedSequenceAssets.Num() > 0)
+	{
+		Extender->AddMenuExtension(
+			"GetAssetActions", EExtensionHook::After, TSharedPtr<FUICommandList>(),
+			FMenuExtensionDelegate::CreateStatic(OVRLipSyncSequenceContextMenuExtension, SelectedSequenceAssets));
+	}
 	return Extender;
 }
 
@@ -239,6 +151,8 @@ public:
 		ContextMenuExtenders.Add(
 			FContentBrowserMenuExtender_SelectedAssets::CreateStatic(OVRLipSyncContextMenuExtender));
 	}
+
+	void ShutdownModule() override { FOVRLipSyncGenerationBatch::Shutdown(); }
 };
 
 IMPLEMENT_MODULE(FOVRLipSyncEditorModule, OVRLipSyncEditor);
@@ -0,0 +1,421 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerateCommandlet.cpp
+ * Content     :   OVRLipSync multi-process sequence generation
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncGenerateCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "OVRLipSyncGenerationBatch.h"
+#include "OVRLipSyncGenerator.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sound/SoundWave.h"
+
+namespace
+{
+// Workers report to the coordinator through their standard output, messages are marked with this tag:
+//   Progress <completed> <failed> <total> <audio seconds of completed sound waves>
+//   Done <completed> <failed> <peak memory MB>
+const TCHAR *WorkerMessageTag = TEXT("OVRLipSyncWorker:");
+
+struct FWorkerProcess
+{
+	FProcHandle Proc;
+	void *ReadPipe = nullptr;
+	void *WritePipe = nullptr;
+	FString ShardPath;
+	FString ResultsPath;
+	TArray<FString> SoundWaves;
+	// Output not yet split into lines
+	FString PendingOutput;
+	int32 NumCompleted = 0;
+	int32 NumFailed = 0;
+	double AudioSeconds = 0.0;
+	double PeakMemoryMB = 0.0;
+	bool bRunning = true;
+};
+
+void ParseWorkerMessage(FWorkerProcess &Worker, const FString &Line)
+{
+	const auto TagPos = Line.Find(WorkerMessageTag);
+	if (TagPos == INDEX_NONE)
+	{
+		return;
+	}
+	TArray<FString> Words;
+	Line.Mid(TagPos + FCString::Strlen(WorkerMessageTag)).ParseIntoArrayWS(Words);
+	if (Words.Num() == 5 && Words[0] == TEXT("Progress"))
+	{
+		Worker.NumCompleted = FCString::Atoi(*Words[1]);
+		Worker.NumFailed = FCString::Atoi(*Words[2]);
+		Worker.AudioSeconds = FCString::Atod(*Words[4]);
+	}
+	else if (Words.Num() == 4 && Words[0] == TEXT("Done"))
+	{
+		Worker.NumCompleted = FCString::Atoi(*Words[1]);
+		Worker.NumFailed = FCString::Atoi(*Words[2]);
+		Worker.PeakMemoryMB = FCString::Atod(*Words[3]);
+	}
+}
+
+void ReadWorkerOutput(FWorkerProcess &Worker)
+{
+	Worker.PendingOutput += FPlatformProcess::ReadPipe(Worker.ReadPipe);
+	int32 LineEnd;
+	while (Worker.PendingOutput.FindChar(TEXT('\n'), LineEnd))
+	{
+		ParseWorkerMessage(Worker, Worker.PendingOutput.Left(LineEnd));
+		Worker.PendingOutput.RightChopInline(LineEnd + 1);
+	}
+}
+
+// Results files hold one size prefixed record per sequence, keyed by the full sound wave object path.
+// Records are flushed one by one, so a crashing worker keeps the sequences it completed.
+struct FWorkerResult
+{
+	FString SoundWavePath;
+	float FrameRate = 0.0f;
+	FOVRLipSyncFrameData Frames;
+
+	friend FArchive &operator<<(FArchive &Ar, FWorkerResult &Result)
+	{
+		return Ar << Result.SoundWavePath << Result.FrameRate << Result.Frames.Visemes << Result.Frames.LaughterScores;
+	}
+};
+
+bool WriteWorkerResult(FArchive &Ar, FWorkerResult &Result)
+{
+	TArray<uint8> Record;
+	FMemoryWriter RecordWriter(Record);
+	RecordWriter << Result;
+	auto RecordSize = Record.Num();
+	Ar << RecordSize;
+	Ar.Serialize(Record.GetData(), Record.Num());
+	Ar.Flush();
+	return !Ar.IsError();
+}
+
+// Reads complete records of a results file, a record cut short by a crash ends the file
+void ReadWorkerResults(const FString &ResultsPath, TMap<FString, FWorkerResult> &OutResults)
+{
+	TArray<uint8> Data;
+	if (!IFileManager::Get().FileExists(*ResultsPath) || !FFileHelper::LoadFileToArray(Data, *ResultsPath))
+	{
+		return;
+	}
+	FMemoryReader Reader(Data);
+	while (Reader.Tell() + static_cast<int64>(sizeof(int32)) <= Reader.TotalSize())
+	{
+		int32 RecordSize = 0;
+		Reader << RecordSize;
+		if (RecordSize <= 0 || Reader.Tell() + RecordSize > Reader.TotalSize())
+		{
+			break;
+		}
+		FMemoryReaderView RecordReader(MakeArrayView(Data.GetData() + Reader.Tell(), RecordSize));
+		FWorkerResult Result;
+		RecordReader << Result;
+		Reader.Seek(Reader.Tell() + RecordSize);
+		if (RecordReader.IsError() ||
+			Result.Frames.Visemes.Num() != Result.Frames.Num() * FOVRLipSyncFrameData::VisemeCount)
+		{
+			break;
+		}
+		OutResults.Add(Result.SoundWavePath, MoveTemp(Result));
+	}
+}
+
+void LogThroughput(const TArray<FWorkerProcess> &Workers, int32 NumTotal, double Elapsed)
+{
+	auto NumCompleted = 0;
+	auto NumFailed = 0;
+	auto AudioSeconds = 0.0;
+	for (const auto &Worker : Workers)
+	{
+		NumCompleted += Worker.NumCompleted;
+		NumFailed += Worker.NumFailed;
+		AudioSeconds += Worker.AudioSeconds;
+	}
+	// Only audio of generated sequences counts towards the realtime factor
+	UE_LOG(LogTemp, Display,
+		   TEXT("Generated %d of %d sequences, %d failed, %.1f s of audio in %.1f s (%.1fx realtime)"), NumCompleted,
+		   NumTotal, NumFailed, AudioSeconds, Elapsed, Elapsed > 0.0 ? AudioSeconds / Elapsed : 0.0);
+}
+} // namespace
+
+UOVRLipSyncGenerateCommandlet::UOVRLipSyncGenerateCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UOVRLipSyncGenerateCommandlet::Main(const FString &Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const auto bUseOfflineModel = Switches.Contains(TEXT("Offline"));
+	if (const auto ShardPath = ParamValues.Find(TEXT("Shard")))
+	{
+		return RunWorker(*ShardPath, ParamValues.FindRef(TEXT("Output")), bUseOfflineModel);
+	}
+
+	TArray<FString> ContentPaths;
+	ParamValues.FindRef(TEXT("Paths")).ParseIntoArray(ContentPaths, TEXT("+"));
+	if (ContentPaths.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=OVRLipSyncGenerate -Paths=/Game/Dir1+/Game/Dir2 [-Workers=N] [-Offline]"));
+		return 1;
+	}
+	const auto WorkersValue = ParamValues.Find(TEXT("Workers"));
+	const auto NumWorkers = WorkersValue ? FCString::Atoi(**WorkersValue)
+										 : FMath::Clamp(FPlatformMisc::NumberOfCores() / 2, 1, 8);
+	return RunCoordinator(ContentPaths, FMath::Max(1, NumWorkers), bUseOfflineModel);
+}
+
+int32 UOVRLipSyncGenerateCommandlet::RunCoordinator(const TArray<FString> &ContentPaths, int32 NumWorkers,
+													 bool bUseOfflineModel)
+{
+	auto &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(USoundWave::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = true;
+	for (const auto &ContentPath : ContentPaths)
+	{
+		Filter.PackagePaths.Add(*ContentPath);
+	}
+	TArray<FAssetData> SoundWaveAssets;
+	AssetRegistry.GetAssets(Filter, SoundWaveAssets);
+	if (SoundWaveAssets.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No sound waves found under %s"), *FString::Join(ContentPaths, TEXT(", ")));
+		return 0;
+	}
+	NumWorkers = FMath::Min(NumWorkers, SoundWaveAssets.Num());
+
+	// Shards are interleaved, so sound waves of a directory, often of similar length, are spread across workers
+	const auto ShardDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("OVRLipSync"), TEXT("Shards"));
+	TArray<FWorkerProcess> Workers;
+	Workers.SetNum(NumWorkers);
+	for (int32 Idx = 0; Idx < SoundWaveAssets.Num(); ++Idx)
+	{
+		Workers[Idx % NumWorkers].SoundWaves.Add(SoundWaveAssets[Idx].GetObjectPathString());
+	}
+
+	const auto ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const auto StartTime = FPlatformTime::Seconds();
+	for (int32 Idx = 0; Idx < NumWorkers; ++Idx)
+	{
+		auto &Worker = Workers[Idx];
+		Worker.ShardPath = FPaths::Combine(ShardDir, FString::Printf(TEXT("Shard%d.txt"), Idx));
+		Worker.ResultsPath = FPaths::Combine(ShardDir, FString::Printf(TEXT("Shard%d.results"), Idx));
+		IFileManager::Get().Delete(*Worker.ResultsPath, false, true, true);
+		if (!FFileHelper::SaveStringArrayToFile(Worker.SoundWaves, *Worker.ShardPath) ||
+			!FPlatformProcess::CreatePipe(Worker.ReadPipe, Worker.WritePipe))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't prepare worker %d"), Idx);
+			Worker.bRunning = false;
+			continue;
+		}
+		const auto Args = FString::Printf(
+			TEXT("\"%s\" -run=OVRLipSyncGenerate -Shard=\"%s\" -Output=\"%s\"%s -unattended -nullrhi -nosplash ")
+				TEXT("-nopause -stdout -FullStdOutLogOutput"),
+			*ProjectPath, *FPaths::ConvertRelativePathToFull(Worker.ShardPath),
+			*FPaths::ConvertRelativePathToFull(Worker.ResultsPath), bUseOfflineModel ? TEXT(" -Offline") : TEXT(""));
+		Worker.Proc = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Args, false, true, true,
+												   nullptr, 0, nullptr, Worker.WritePipe);
+		if (!Worker.Proc.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't start worker %d"), Idx);
+			Worker.bRunning = false;
+		}
+	}
+	UE_LOG(LogTemp, Display, TEXT("Generating %d sequences with %d worker processes"), SoundWaveAssets.Num(),
+		   NumWorkers);
+
+	auto NumRunning = NumWorkers;
+	auto LastReportTime = StartTime;
+	while (NumRunning > 0)
+	{
+		NumRunning = 0;
+		for (auto &Worker : Workers)
+		{
+			if (!Worker.bRunning)
+			{
+				continue;
+			}
+			ReadWorkerOutput(Worker);
+			if (FPlatformProcess::IsProcRunning(Worker.Proc))
+			{
+				++NumRunning;
+				continue;
+			}
+			// Output written right before exiting could still be in the pipe
+			ReadWorkerOutput(Worker);
+			Worker.bRunning = false;
+			int32 ReturnCode = 0;
+			FPlatformProcess::GetProcReturnCode(Worker.Proc, &ReturnCode);
+			if (ReturnCode != 0)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Worker for %s exited with code %d"), *Worker.ShardPath, ReturnCode);
+			}
+		}
+		const auto Now = FPlatformTime::Seconds();
+		if (Now - LastReportTime >= 5.0)
+		{
+			LogThroughput(Workers, SoundWaveAssets.Num(), Now - StartTime);
+			LastReportTime = Now;
+		}
+		FPlatformProcess::Sleep(0.1f);
+	}
+	const auto GenerationTime = FPlatformTime::Seconds() - StartTime;
+
+	// Assets are only created by the coordinator, so workers never write the same packages
+	FOVRLipSyncBatchMemory Memory;
+	auto NumFailed = 0;
+	for (auto &Worker : Workers)
+	{
+		FPlatformProcess::CloseProc(Worker.Proc);
+		FPlatformProcess::ClosePipe(Worker.ReadPipe, Worker.WritePipe);
+
+		TMap<FString, FWorkerResult> Results;
+		ReadWorkerResults(Worker.ResultsPath, Results);
+		for (const auto &SoundWave : Worker.SoundWaves)
+		{
+			auto Result = Results.Find(SoundWave);
+			if (!Result)
+			{
+				UE_LOG(LogTemp, Error, TEXT("No sequence generated for %s"), *SoundWave);
+				++NumFailed;
+				continue;
+			}
+			auto Sequence = FOVRLipSyncGenerationBatch::SaveSequence(FSoftObjectPath(SoundWave),
+																	 MoveTemp(Result->Frames), Result->FrameRate);
+			Memory.Add(Sequence->GetPackage());
+			Memory.Release();
+		}
+		IFileManager::Get().Delete(*Worker.ShardPath, false, true, true);
+		IFileManager::Get().Delete(*Worker.ResultsPath, false, true, true);
+	}
+
+	auto WorkerPeakMemoryMB = 0.0;
+	for (const auto &Worker : Workers)
+	{
+		WorkerPeakMemoryMB = FMath::Max(WorkerPeakMemoryMB, Worker.PeakMemoryMB);
+	}
+	LogThroughput(Workers, SoundWaveAssets.Num(), GenerationTime);
+	UE_LOG(LogTemp, Display, TEXT("Saved %d sequences in %.1f s, %d failed, peak memory %.1f MB (%.1f MB per worker)"),
+		   SoundWaveAssets.Num() - NumFailed, FPlatformTime::Seconds() - StartTime, NumFailed,
+		   Memory.GetPeakUsed() / (1024.0 * 1024.0), WorkerPeakMemoryMB);
+	return NumFailed > 0 ? 1 : 0;
+}
+
+int32 UOVRLipSyncGenerateCommandlet::RunWorker(const FString &ShardPath, const FString &OutputPath,
+												bool bUseOfflineModel)
+{
+	TArray<FString> SoundWavePaths;
+	if (!FFileHelper::LoadFileToStringArray(SoundWavePaths, *ShardPath) || OutputPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't read shard %s"), *ShardPath);
+		return 1;
+	}
+
+	TUniquePtr<FArchive> ResultsWriter(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!ResultsWriter)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't write results to %s"), *OutputPath);
+		return 1;
+	}
+
+	TUniquePtr<FOVRLipSyncGenerator> Generator;
+	FOVRLipSyncBatchMemory Memory;
+	auto NumCompleted = 0;
+	auto NumFailed = 0;
+	auto AudioSeconds = 0.0;
+	FWorkerResult Result;
+	const auto ReportProgress = [&]() {
+		UE_LOG(LogTemp, Display, TEXT("%s Progress %d %d %d %.3f"), WorkerMessageTag, NumCompleted, NumFailed,
+			   SoundWavePaths.Num(), AudioSeconds);
+	};
+	for (const auto &SoundWavePath : SoundWavePaths)
+	{
+		// Whatever this sound wave loaded is released before moving on
+		ON_SCOPE_EXIT { Memory.Release(); };
+		auto SoundWave = Cast<USoundWave>(FSoftObjectPath(SoundWavePath).TryLoad());
+		if (SoundWave)
+		{
+			Memory.Add(SoundWave->GetPackage());
+		}
+		TArray<int16> PCMData;
+		if (!SoundWave || SoundWave->NumChannels > 2 ||
+			!FOVRLipSyncGenerationBatch::GetSoundWavePCM(SoundWave, PCMData))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't get PCM data of %s"), *SoundWavePath);
+			++NumFailed;
+			ReportProgress();
+			continue;
+		}
+
+		// Contexts are reused while consecutive sound waves share the format
+		const auto Settings = FOVRLipSyncGenerationBatch::MakeSettings(SoundWave, bUseOfflineModel);
+		if (!Generator || Generator->GetSettings().SampleRate != Settings.SampleRate ||
+			Generator->GetSettings().NumChannels != Settings.NumChannels)
+		{
+			Generator = MakeUnique<FOVRLipSyncGenerator>(Settings);
+		}
+		Result.SoundWavePath = SoundWavePath;
+		Result.FrameRate = Generator->GetFrameRate();
+		Result.Frames.Reset();
+		if (!Generator->Generate(PCMData.GetData(), PCMData.Num(), Result.Frames))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't generate sequence of %s"), *SoundWavePath);
+			++NumFailed;
+			ReportProgress();
+			continue;
+		}
+		if (!WriteWorkerResult(*ResultsWriter, Result))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Can't write results to %s"), *OutputPath);
+			return 1;
+		}
+		++NumCompleted;
+
+		AudioSeconds += static_cast<double>(PCMData.Num()) / (Settings.SampleRate * Settings.NumChannels);
+		ReportProgress();
+	}
+
+	const auto bSaved = ResultsWriter->Close();
+	UE_LOG(LogTemp, Display, TEXT("%s Done %d %d %.1f"), WorkerMessageTag, NumCompleted, NumFailed,
+		   Memory.GetPeakUsed() / (1024.0 * 1024.0));
+	return bSaved && NumFailed == 0 ? 0 : 1;
+}
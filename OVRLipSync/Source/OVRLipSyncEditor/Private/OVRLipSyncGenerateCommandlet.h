@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerateCommandlet.h
+ * Content     :   Prototypes for OVRLipSync multi-process sequence generation
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "OVRLipSyncGenerateCommandlet.generated.h"
+
+// Generates sequences for all sound waves under the given content paths, sharding them across
+// several worker processes. Every worker runs its own LipSync contexts and appends each result to a
+// results file as soon as it's generated, the coordinator turns those results into sequence assets.
+//
+// Coordinator: -run=OVRLipSyncGenerate -Paths=/Game/Dialogue+/Game/Barks [-Workers=4] [-Offline]
+// Worker:      -run=OVRLipSyncGenerate -Shard=<list file> -Output=<results file> [-Offline]
+UCLASS()
+class UOVRLipSyncGenerateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOVRLipSyncGenerateCommandlet();
+
+	virtual int32 Main(const FString &Params) override;
+
+private:
+	int32 RunCoordinator(const TArray<FString> &ContentPaths, int32 NumWorkers, bool bUseOfflineModel);
+	int32 RunWorker(const FString &ShardPath, const FString &OutputPath, bool bUseOfflineModel);
+};
@@ -0,0 +1,450 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerationBatch.cpp
+ * Content     :   OVRLipSync background sequence generation
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncGenerationBatch.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "OVRLipSyncGenerator.h"
+#include "PackageTools.h"
+#include "Sound/SoundWave.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/UObjectHash.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "NSLT_OVRLipSyncPlugin"
+
+namespace
+{
+
+TAutoConsoleVariable<float> CVarLipSyncHopMs(
+	TEXT("OVRLipSync.Editor.HopMs"), 10.0f,
+	TEXT("Time between frames of generated LipSync sequences, in milliseconds. ")
+		TEXT("Use 5 for close-up cinematics, 20-40 for background dialogue."));
+
+TAutoConsoleVariable<float> CVarLipSyncWindowMs(
+	TEXT("OVRLipSync.Editor.WindowMs"), 10.0f,
+	TEXT("Amount of audio analysed per frame of generated LipSync sequences, in milliseconds. ")
+		TEXT("Values below HopMs skip part of the audio to reduce generation cost."));
+
+const TCHAR *CheckpointOfflineModelTag = TEXT("OfflineModel");
+
+// Copies PCM data of the imported asset into OutPCMData. The sound wave itself is left without decompressed
+// data, so nothing stays attached to it once the caller is done with OutPCMData.
+bool GetImportedPCM(USoundWave *SoundWave, TArray<int16> &OutPCMData)
+{
+	TArray<uint8> ImportedPCM;
+	uint32 SampleRate = 0;
+	uint16 NumChannels = 0;
+	if (!SoundWave->GetImportedSoundWaveData(ImportedPCM, SampleRate, NumChannels) || ImportedPCM.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to get imported PCM data for %s"), *SoundWave->GetName());
+		return false;
+	}
+	OutPCMData.SetNumUninitialized(ImportedPCM.Num() / sizeof(int16));
+	FMemory::Memcpy(OutPCMData.GetData(), ImportedPCM.GetData(), OutPCMData.Num() * sizeof(int16));
+
+	// Make sure metadata matches
+	SoundWave->NumChannels = NumChannels;
+	SoundWave->SetSampleRate(SampleRate, /*bFromDecoders=*/true);
+	return true;
+}
+
+} // namespace
+
+FOVRLipSyncBatchMemory::FOVRLipSyncBatchMemory() { BaselineUsed = FPlatformMemory::GetStats().UsedPhysical; }
+
+bool FOVRLipSyncBatchMemory::IsPackageLoaded(const FString &PackageName)
+{
+	return FindPackage(nullptr, *PackageName) != nullptr;
+}
+
+void FOVRLipSyncBatchMemory::Add(UPackage *Package)
+{
+	if (Package)
+	{
+		Packages.AddUnique(Package);
+	}
+}
+
+uint64 FOVRLipSyncBatchMemory::GetPeakUsed() const { return FPlatformMemory::GetStats().PeakUsedPhysical; }
+
+uint64 FOVRLipSyncBatchMemory::GetPeakAboveBaseline() const
+{
+	const auto PeakUsed = GetPeakUsed();
+	return PeakUsed > BaselineUsed ? PeakUsed - BaselineUsed : 0;
+}
+
+bool FOVRLipSyncBatchMemory::IsPackageOpen(UPackage *Package)
+{
+	auto AssetEditors = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	if (!AssetEditors)
+	{
+		return false;
+	}
+	auto bOpen = false;
+	ForEachObjectWithPackage(Package, [AssetEditors, &bOpen](UObject *Object) {
+		bOpen = AssetEditors->FindEditorsForAsset(Object).Num() > 0;
+		return !bOpen;
+	});
+	return bOpen;
+}
+
+void FOVRLipSyncBatchMemory::Release()
+{
+	TArray<UPackage *> Unloaded;
+	for (const auto &Package : Packages)
+	{
+		if (Package.IsValid() && !Package->IsDirty() && !IsPackageOpen(Package.Get()))
+		{
+			Unloaded.Add(Package.Get());
+		}
+	}
+	Packages.Reset();
+	if (Unloaded.Num() == 0)
+	{
+		return;
+	}
+	// Unloading collects garbage, which frees frames and bulk data of the released assets
+	FText ErrorMessage;
+	if (!UPackageTools::UnloadPackages(Unloaded, ErrorMessage))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Can't unload LipSync batch packages: %s"), *ErrorMessage.ToString());
+	}
+}
+
+TSharedPtr<FOVRLipSyncGenerationBatch> FOVRLipSyncGenerationBatch::Instance;
+
+FOVRLipSyncGenerationBatch::FOVRLipSyncGenerationBatch(bool bInUseOfflineModel) : bUseOfflineModel(bInUseOfflineModel)
+{
+}
+
+FString FOVRLipSyncGenerationBatch::GetCheckpointPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("OVRLipSync"), TEXT("GenerationCheckpoint.txt"));
+}
+
+void FOVRLipSyncGenerationBatch::Start(const TArray<FSoftObjectPath> &SoundWaves, bool bUseOfflineModel)
+{
+	if (Instance)
+	{
+		if (Instance->bUseOfflineModel != bUseOfflineModel)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("LipSync generation is running with a different model, added sound waves "
+										  "will use the running batch settings"));
+		}
+		Instance->Add(SoundWaves);
+		return;
+	}
+
+	Instance = TSharedPtr<FOVRLipSyncGenerationBatch>(new FOVRLipSyncGenerationBatch(bUseOfflineModel));
+	Instance->StartTime = FPlatformTime::Seconds();
+
+	FNotificationInfo Info(LOCTEXT("GeneratingLipSyncSequences", "Generating LipSync sequences..."));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 5.0f;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelLipSyncGeneration", "Cancel"),
+		LOCTEXT("CancelLipSyncGeneration_Tooltip", "Aborts the sound wave in progress, sequences already completed are kept"),
+		FSimpleDelegate::CreateSP(Instance.ToSharedRef(), &FOVRLipSyncGenerationBatch::Cancel),
+		SNotificationItem::CS_Pending));
+	Instance->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	if (Instance->Notification)
+	{
+		Instance->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	Instance->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(Instance.ToSharedRef(), &FOVRLipSyncGenerationBatch::Tick));
+	Instance->Add(SoundWaves);
+}
+
+bool FOVRLipSyncGenerationBatch::CanResume() { return !Instance && FPaths::FileExists(GetCheckpointPath()); }
+
+void FOVRLipSyncGenerationBatch::Resume()
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetCheckpointPath()) || Lines.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't read LipSync generation checkpoint %s"), *GetCheckpointPath());
+		return;
+	}
+	const auto bUseOfflineModel = Lines[0] == CheckpointOfflineModelTag;
+	TArray<FSoftObjectPath> SoundWaves;
+	for (int32 Idx = 1; Idx < Lines.Num(); ++Idx)
+	{
+		SoundWaves.Emplace(Lines[Idx]);
+	}
+	UE_LOG(LogTemp, Log, TEXT("Resuming LipSync generation, %d sound waves left"), SoundWaves.Num());
+	Start(SoundWaves, bUseOfflineModel);
+}
+
+void FOVRLipSyncGenerationBatch::Shutdown()
+{
+	if (!Instance)
+	{
+		return;
+	}
+	// The checkpoint is kept, so the batch could be resumed in the next session
+	Instance->bCancelRequested = true;
+	if (Instance->Worker.IsValid())
+	{
+		Instance->Worker.Wait();
+	}
+	FTSTicker::GetCoreTicker().RemoveTicker(Instance->TickerHandle);
+	Instance = nullptr;
+}
+
+void FOVRLipSyncGenerationBatch::Add(const TArray<FSoftObjectPath> &SoundWaves)
+{
+	for (const auto &SoundWave : SoundWaves)
+	{
+		if (!Pending.Contains(SoundWave))
+		{
+			Pending.Add(SoundWave);
+			++NumTotal;
+		}
+	}
+	WriteCheckpoint();
+	UpdateNotification();
+}
+
+void FOVRLipSyncGenerationBatch::Cancel()
+{
+	bCancelRequested = true;
+	UpdateNotification();
+}
+
+bool FOVRLipSyncGenerationBatch::Tick(float DeltaTime)
+{
+	// Keep the batch alive while ticking, End releases the instance
+	auto Self = AsShared();
+	if (Worker.IsValid())
+	{
+		if (!Worker.IsReady())
+		{
+			UpdateNotification();
+			return true;
+		}
+		const auto bCompleted = Worker.Get();
+		Worker = TFuture<bool>();
+		if (bCompleted && !bCancelRequested)
+		{
+			FinishCurrent();
+		}
+	}
+	if (bCancelRequested)
+	{
+		End(true);
+		return false;
+	}
+	if (Pending.Num() == 0)
+	{
+		End(false);
+		return false;
+	}
+	StartNext();
+	UpdateNotification();
+	return true;
+}
+
+void FOVRLipSyncGenerationBatch::StartNext()
+{
+	const auto ObjectPath = Pending[0].ToString();
+	const auto bWasLoaded = FOVRLipSyncBatchMemory::IsPackageLoaded(Pending[0].GetLongPackageName());
+	auto SoundWave = Cast<USoundWave>(Pending[0].TryLoad());
+	if (SoundWave && !bWasLoaded)
+	{
+		Memory.Add(SoundWave->GetPackage());
+	}
+	// The worker gets its own copy of PCM data, as the sound wave could be collected while it runs
+	TArray<int16> PCMData;
+	auto bValid = false;
+	if (!SoundWave)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't find %s"), *ObjectPath);
+	}
+	else if (SoundWave->NumChannels > 2)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Can't process %s: only mono and stereo streams are supported"), *ObjectPath);
+	}
+	else if (!GetSoundWavePCM(SoundWave, PCMData))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to decompress SoundWave %s"), *ObjectPath);
+	}
+	else
+	{
+		bValid = true;
+	}
+	if (!bValid)
+	{
+		// Skipped sound waves are dropped from the checkpoint, resuming wouldn't fix them
+		Memory.Release();
+		Pending.RemoveAt(0);
+		--NumTotal;
+		WriteCheckpoint();
+		return;
+	}
+
+	const auto Settings = MakeSettings(SoundWave, bUseOfflineModel);
+	Frames.Reset();
+	Progress = 0.0f;
+	Worker = Async(EAsyncExecution::ThreadPool, [this, Self = AsShared(), PCMData = MoveTemp(PCMData), Settings]() {
+		FOVRLipSyncGenerator Generator(Settings);
+		FrameRate = Generator.GetFrameRate();
+		return Generator.Generate(PCMData.GetData(), PCMData.Num(), Frames, [this](float NewProgress) {
+			Progress = NewProgress;
+			return !bCancelRequested;
+		});
+	});
+}
+
+bool FOVRLipSyncGenerationBatch::GetSoundWavePCM(USoundWave *SoundWave, TArray<int16> &OutPCMData)
+{
+	if (!SoundWave)
+	{
+		return false;
+	}
+	// PCM data the engine already decompressed is borrowed
+	if (SoundWave->RawPCMData && SoundWave->RawPCMDataSize > 0)
+	{
+		OutPCMData = TArray<int16>(reinterpret_cast<const int16 *>(SoundWave->RawPCMData),
+								   static_cast<int32>(SoundWave->RawPCMDataSize / sizeof(int16)));
+		return true;
+	}
+	return GetImportedPCM(SoundWave, OutPCMData);
+}
+
+FOVRLipSyncGenerationSettings FOVRLipSyncGenerationBatch::MakeSettings(const USoundWave *SoundWave,
+																		bool bUseOfflineModel)
+{
+	FOVRLipSyncGenerationSettings Settings;
+	Settings.NumChannels = SoundWave->NumChannels;
+	Settings.SampleRate = SoundWave->GetSampleRateForCurrentPlatform();
+	Settings.ModelPath = bUseOfflineModel ? FOVRLipSyncGenerator::GetOfflineModelPath() : FString();
+	Settings.HopMs = CVarLipSyncHopMs.GetValueOnGameThread();
+	Settings.WindowMs = CVarLipSyncWindowMs.GetValueOnGameThread();
+	return Settings;
+}
+
+UOVRLipSyncFrameSequence *FOVRLipSyncGenerationBatch::SaveSequence(const FSoftObjectPath &SoundWavePath,
+																	FOVRLipSyncFrameData &&InFrames, float InFrameRate)
+{
+	auto SequenceName = FString::Printf(TEXT("%s_LipSyncSequence"), *SoundWavePath.GetAssetName());
+	auto SequencePath = FString::Printf(TEXT("%s_LipSyncSequence"), *SoundWavePath.GetLongPackageName());
+	auto SequencePackage = CreatePackage(*SequencePath);
+	auto Sequence = NewObject<UOVRLipSyncFrameSequence>(SequencePackage, *SequenceName, RF_Public | RF_Standalone);
+	Sequence->FrameRate = InFrameRate;
+	Sequence->Frames = MoveTemp(InFrames);
+	Sequence->BuildSpeechIndex();
+
+	FAssetRegistryModule::AssetCreated(Sequence);
+	Sequence->MarkPackageDirty();
+	UEditorLoadingAndSavingUtils::SavePackages({SequencePackage}, true);
+	return Sequence;
+}
+
+void FOVRLipSyncGenerationBatch::FinishCurrent()
+{
+	// Saved right away, so the checkpoint never lists a sequence that would be lost with the session
+	const auto bWasLoaded =
+		FOVRLipSyncBatchMemory::IsPackageLoaded(Pending[0].GetLongPackageName() + TEXT("_LipSyncSequence"));
+	auto Sequence = SaveSequence(Pending[0], MoveTemp(Frames), FrameRate);
+	if (!bWasLoaded)
+	{
+		Memory.Add(Sequence->GetPackage());
+	}
+	// Neither the sound wave nor its sequence are needed past this point
+	Memory.Release();
+
+	Pending.RemoveAt(0);
+	++NumCompleted;
+	WriteCheckpoint();
+}
+
+void FOVRLipSyncGenerationBatch::End(bool bCancelled)
+{
+	const auto Elapsed = FPlatformTime::Seconds() - StartTime;
+	Memory.Release();
+	UE_LOG(LogTemp, Log,
+		   TEXT("LipSync generation %s: %d of %d sequences in %.1fs, peak memory %.1f MB above the %.1f MB in use "
+				"at start"),
+		   bCancelled ? TEXT("cancelled") : TEXT("finished"), NumCompleted, NumTotal, Elapsed,
+		   Memory.GetPeakAboveBaseline() / (1024.0 * 1024.0), Memory.GetBaselineUsed() / (1024.0 * 1024.0));
+	if (!bCancelled)
+	{
+		IFileManager::Get().Delete(*GetCheckpointPath());
+	}
+
+	if (Notification)
+	{
+		Notification->SetText(
+			bCancelled ? FText::Format(LOCTEXT("LipSyncGenerationCancelled",
+											   "LipSync generation cancelled, {0} sequences left. Resume it from the "
+											   "sound wave context menu"),
+									   FText::AsNumber(Pending.Num()))
+					   : FText::Format(LOCTEXT("LipSyncGenerationFinished", "Generated {0} LipSync sequences"),
+									   FText::AsNumber(NumCompleted)));
+		Notification->SetCompletionState(bCancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Notification->ExpireAndFadeout();
+		Notification = nullptr;
+	}
+	Instance = nullptr;
+}
+
+void FOVRLipSyncGenerationBatch::UpdateNotification()
+{
+	if (!Notification)
+	{
+		return;
+	}
+	if (bCancelRequested)
+	{
+		Notification->SetText(LOCTEXT("CancellingLipSyncGeneration", "Cancelling LipSync generation..."));
+		return;
+	}
+	const auto Current = Pending.Num() > 0 ? FText::FromString(Pending[0].GetAssetName()) : FText::GetEmpty();
+	Notification->SetText(
+		FText::Format(LOCTEXT("GeneratingLipSyncSequence", "Generating LipSync sequence {0} of {1}: {2} ({3})"),
+					  FText::AsNumber(NumCompleted + 1), FText::AsNumber(NumTotal), Current,
+					  FText::AsPercent(Progress.load())));
+}
+
+void FOVRLipSyncGenerationBatch::WriteCheckpoint() const
+{
+	TArray<FString> Lines;
+	Lines.Add(bUseOfflineModel ? CheckpointOfflineModelTag : TEXT("OnlineModel"));
+	for (const auto &SoundWave : Pending)
+	{
+		Lines.Add(SoundWave.ToString());
+	}
+	FFileHelper::SaveStringArrayToFile(Lines, *GetCheckpointPath());
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncGenerationBatch.h
+ * Content     :   Prototypes for OVRLipSync background sequence generation
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "OVRLipSyncFrame.h"
+#include "OVRLipSyncGenerator.h"
+
+#include <atomic>
+
+class SNotificationItem;
+class UPackage;
+class USoundWave;
+
+// Keeps memory of a batch bounded: packages loaded or created for an asset are unloaded once the asset is
+// done, before the batch moves on. Packages that were already loaded, have unsaved changes or are open in an
+// editor are left alone.
+class FOVRLipSyncBatchMemory
+{
+public:
+	FOVRLipSyncBatchMemory();
+
+	static bool IsPackageLoaded(const FString &PackageName);
+
+	// Adds package the batch loaded or created
+	void Add(UPackage *Package);
+
+	// Unloads all added packages
+	void Release();
+
+	// Peak process memory use, in bytes. The platform tracks it continuously, so peaks reached while an asset
+	// is generated are included.
+	uint64 GetPeakUsed() const;
+	uint64 GetBaselineUsed() const { return BaselineUsed; }
+	// Growth of the peak over the memory in use when the batch started. An earlier, higher peak of the process
+	// shows up here as well.
+	uint64 GetPeakAboveBaseline() const;
+
+private:
+	static bool IsPackageOpen(UPackage *Package);
+
+	TArray<TWeakObjectPtr<UPackage>> Packages;
+	uint64 BaselineUsed = 0;
+};
+
+// Generates sequences for a list of sound waves in the background, one at a time, reporting progress
+// in a non-modal notification. Every sequence is saved as soon as it is done and the remaining
+// sound waves are checkpointed, so a cancelled or interrupted batch could be resumed later.
+class FOVRLipSyncGenerationBatch : public TSharedFromThis<FOVRLipSyncGenerationBatch>
+{
+public:
+	// Starts a batch, or adds sound waves to the running one
+	static void Start(const TArray<FSoftObjectPath> &SoundWaves, bool bUseOfflineModel);
+
+	// True if a previous batch left a checkpoint and no batch is running
+	static bool CanResume();
+	static void Resume();
+
+	// Cancels running batch and waits for its worker
+	static void Shutdown();
+
+	// Copies 16-bit PCM data of SoundWave into a buffer owned by the caller, nothing is attached to SoundWave
+	static bool GetSoundWavePCM(USoundWave *SoundWave, TArray<int16> &OutPCMData);
+
+	// Generation settings for SoundWave, taken from editor console variables
+	static FOVRLipSyncGenerationSettings MakeSettings(const USoundWave *SoundWave, bool bUseOfflineModel);
+
+	// Creates and saves the sequence asset placed next to the sound wave
+	static UOVRLipSyncFrameSequence *SaveSequence(const FSoftObjectPath &SoundWavePath, FOVRLipSyncFrameData &&Frames,
+												  float FrameRate);
+
+private:
+	FOVRLipSyncGenerationBatch(bool bInUseOfflineModel);
+
+	void Add(const TArray<FSoftObjectPath> &SoundWaves);
+	bool Tick(float DeltaTime);
+	void StartNext();
+	void FinishCurrent();
+	void Cancel();
+	void End(bool bCancelled);
+	void UpdateNotification();
+	void WriteCheckpoint() const;
+
+	static FString GetCheckpointPath();
+
+	static TSharedPtr<FOVRLipSyncGenerationBatch> Instance;
+
+	bool bUseOfflineModel;
+	// Sound waves without a saved sequence yet, the first one is being generated
+	TArray<FSoftObjectPath> Pending;
+	int32 NumTotal = 0;
+	int32 NumCompleted = 0;
+	double StartTime = 0.0;
+
+	// Frames of the first pending sound wave, written by the worker until it completes
+	FOVRLipSyncFrameData Frames;
+	float FrameRate = 0.0f;
+	TFuture<bool> Worker;
+	std::atomic<float> Progress{0.0f};
+	std::atomic<bool> bCancelRequested{false};
+
+	FOVRLipSyncBatchMemory Memory;
+
+	TSharedPtr<SNotificationItem> Notification;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
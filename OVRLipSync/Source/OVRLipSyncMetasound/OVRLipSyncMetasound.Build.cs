@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncMetasound.Build.cs
+ * Content     :   Unreal build script for OVRLipSync MetaSound nodes
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+using UnrealBuildTool;
+
+public class OVRLipSyncMetasound : ModuleRules
+{
+    public OVRLipSyncMetasound(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+        PrivateDependencyModuleNames.AddRange(new string[] {
+          "Core",
+          "CoreUObject",
+          "MetasoundFrontend",
+          "MetasoundGraphCore",
+          "OVRLipSync"
+        });
+    }
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncAnalyzerNode.cpp
+ * Content     :   MetaSound node running OVRLipSync analysis
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "Misc/EngineVersionComparison.h"
+#include "OVRLipSyncContextWrapper.h"
+
+#define LOCTEXT_NAMESPACE "OVRLipSyncMetasound"
+
+namespace Metasound
+{
+namespace OVRLipSyncAnalyzerNode
+{
+METASOUND_PARAM(InputAudio, "In", "Mono audio to analyse.")
+METASOUND_PARAM(OutputLaughter, "Laughter", "Predicted laughter probability.")
+
+// Output pin per viseme, in ovrLipSyncViseme order
+const FLazyName VisemeOutputNames[] = {TEXT("sil"), TEXT("PP"), TEXT("FF"), TEXT("TH"), TEXT("DD"),
+									   TEXT("kk"),  TEXT("CH"), TEXT("SS"), TEXT("nn"), TEXT("RR"),
+									   TEXT("aa"),  TEXT("E"),  TEXT("ih"), TEXT("oh"), TEXT("ou")};
+static_assert(UE_ARRAY_COUNT(VisemeOutputNames) == ovrLipSyncViseme_Count, "Unexpected number of visemes");
+} // namespace OVRLipSyncAnalyzerNode
+
+// Runs every rendered block through a LipSync context, so viseme scores are produced on the audio
+// render thread and never leave the MetaSound graph as PCM
+class FOVRLipSyncAnalyzerOperator : public TExecutableOperator<FOVRLipSyncAnalyzerOperator>
+{
+public:
+	static const FNodeClassMetadata &GetNodeInfo()
+	{
+		auto CreateNodeClassMetadata = []() -> FNodeClassMetadata {
+			FNodeClassMetadata Metadata;
+			Metadata.ClassName = {TEXT("OVRLipSync"), TEXT("LipSyncAnalyzer"), TEXT("Audio")};
+			Metadata.MajorVersion = 1;
+			Metadata.MinorVersion = 0;
+			Metadata.DisplayName = LOCTEXT("LipSyncAnalyzer_DisplayName", "LipSync Analyzer");
+			Metadata.Description =
+				LOCTEXT("LipSyncAnalyzer_Description", "Predicts viseme and laughter scores of the input audio.");
+			Metadata.Author = TEXT("Oculus");
+			Metadata.PromptIfMissing = LOCTEXT("LipSyncAnalyzer_PromptIfMissing", "Enable the Oculus Lipsync plugin");
+			Metadata.DefaultInterface = GetVertexInterface();
+			Metadata.CategoryHierarchy = {LOCTEXT("LipSyncAnalyzer_Category", "Analysis")};
+			return Metadata;
+		};
+		static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+		return Metadata;
+	}
+
+	static const FVertexInterface &GetVertexInterface()
+	{
+		using namespace OVRLipSyncAnalyzerNode;
+
+		auto CreateVertexInterface = []() -> FVertexInterface {
+			FOutputVertexInterface Outputs;
+			for (const auto &VisemeName : VisemeOutputNames)
+			{
+				Outputs.Add(TOutputDataVertex<float>(
+					VisemeName.Resolve(),
+					FDataVertexMetadata{FText::Format(LOCTEXT("VisemeOutput_Description", "Predicted {0} viseme score."),
+													  FText::FromName(VisemeName.Resolve())),
+										FText::FromName(VisemeName.Resolve())}));
+			}
+			Outputs.Add(TOutputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLaughter)));
+
+			return FVertexInterface(
+				FInputVertexInterface(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAudio))),
+				Outputs);
+		};
+		static const FVertexInterface Interface = CreateVertexInterface();
+		return Interface;
+	}
+
+#if UE_VERSION_OLDER_THAN(5, 3, 0)
+	static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams &InParams, FBuildErrorArray &OutErrors)
+	{
+		using namespace OVRLipSyncAnalyzerNode;
+
+		auto AudioInput = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FAudioBuffer>(
+			METASOUND_GET_PARAM_NAME(InputAudio), InParams.OperatorSettings);
+		return MakeUnique<FOVRLipSyncAnalyzerOperator>(InParams.OperatorSettings, AudioInput);
+	}
+#else
+	static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams &InParams, FBuildResults &OutResults)
+	{
+		using namespace OVRLipSyncAnalyzerNode;
+
+		auto AudioInput = InParams.InputData.GetOrConstructDataReadReference<FAudioBuffer>(
+			METASOUND_GET_PARAM_NAME(InputAudio), InParams.OperatorSettings);
+		return MakeUnique<FOVRLipSyncAnalyzerOperator>(InParams.OperatorSettings, AudioInput);
+	}
+#endif
+
+	FOVRLipSyncAnalyzerOperator(const FOperatorSettings &InSettings, const FAudioBufferReadRef &InAudioInput)
+		: AudioInput(InAudioInput), LaughterOutput(FFloatWriteRef::CreateNew(0.0f))
+	{
+		for (int32 Idx = 0; Idx < ovrLipSyncViseme_Count; ++Idx)
+		{
+			VisemeOutputs.Add(FFloatWriteRef::CreateNew(Idx == 0 ? 1.0f : 0.0f));
+		}
+		Visemes.SetNumZeroed(ovrLipSyncViseme_Count);
+		Context = MakeUnique<UOVRLipSyncContextWrapper>(ovrLipSyncContextProvider_EnhancedWithLaughter,
+														 static_cast<int>(InSettings.GetSampleRate()));
+	}
+
+	virtual void BindInputs(FInputVertexInterfaceData &InOutVertexData) override
+	{
+		using namespace OVRLipSyncAnalyzerNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputAudio), AudioInput);
+	}
+
+	virtual void BindOutputs(FOutputVertexInterfaceData &InOutVertexData) override
+	{
+		using namespace OVRLipSyncAnalyzerNode;
+		for (int32 Idx = 0; Idx < VisemeOutputs.Num(); ++Idx)
+		{
+			InOutVertexData.BindReadVertex(VisemeOutputNames[Idx].Resolve(), VisemeOutputs[Idx]);
+		}
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputLaughter), LaughterOutput);
+	}
+
+	void Execute()
+	{
+		float LaughterScore = 0.0f;
+		int32_t FrameDelay = 0;
+		Context->ProcessFrame(AudioInput->GetData(), AudioInput->Num(), Visemes, LaughterScore, FrameDelay);
+
+		for (int32 Idx = 0; Idx < VisemeOutputs.Num(); ++Idx)
+		{
+			*VisemeOutputs[Idx] = Visemes[Idx];
+		}
+		*LaughterOutput = LaughterScore;
+	}
+
+private:
+	FAudioBufferReadRef AudioInput;
+	TArray<FFloatWriteRef> VisemeOutputs;
+	FFloatWriteRef LaughterOutput;
+
+	TUniquePtr<UOVRLipSyncContextWrapper> Context;
+	// Preallocated, so Execute never allocates on the render thread
+	TArray<float> Visemes;
+};
+
+class FOVRLipSyncAnalyzerNode : public FNodeFacade
+{
+public:
+	FOVRLipSyncAnalyzerNode(const FNodeInitData &InitData)
+		: FNodeFacade(InitData.InstanceName, InitData.InstanceID,
+					  TFacadeOperatorClass<FOVRLipSyncAnalyzerOperator>())
+	{
+	}
+};
+
+METASOUND_REGISTER_NODE(FOVRLipSyncAnalyzerNode)
+} // namespace Metasound
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncNRT.cpp
+ * Content     :   OVRLipSync non-real-time audio analyzer
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncNRT.h"
+
+#include "Async/Async.h"
+#include "OVRLipSyncNRTFactory.h"
+#include "Sound/SoundWave.h"
+
+bool UOVRLipSyncNRT::GetVisemesAtTime(float InSeconds, TArray<float> &OutVisemes, float &OutLaughterScore) const
+{
+	auto Result = GetResult<Audio::FOVRLipSyncNRTResult>();
+	if (!Result.IsValid() || Result->Frames.Num() == 0)
+	{
+		return false;
+	}
+	const auto Idx = FMath::Clamp(FMath::FloorToInt(InSeconds * Result->FrameRate), 0, Result->Frames.Num() - 1);
+	OutVisemes = Result->Frames.GetVisemes(Idx);
+	OutLaughterScore = Result->Frames.GetLaughterScore(Idx);
+	return true;
+}
+
+float UOVRLipSyncNRT::GetFrameRate() const
+{
+	auto Result = GetResult<Audio::FOVRLipSyncNRTResult>();
+	return Result.IsValid() ? Result->FrameRate : 0.0f;
+}
+
+FName UOVRLipSyncNRT::GetAnalyzerNRTFactoryName() const { return Audio::FOVRLipSyncNRTFactory::Name; }
+
+TUniquePtr<Audio::IAnalyzerNRTSettings> UOVRLipSyncNRT::GetSettings(const float InSampleRate,
+																	  const int32 InNumChannels) const
+{
+	auto AnalyzerSettings = MakeUnique<Audio::FOVRLipSyncNRTSettings>();
+	if (Settings)
+	{
+		AnalyzerSettings->bUseOfflineModel = Settings->bUseOfflineModel;
+		AnalyzerSettings->HopMs = Settings->HopMs;
+		AnalyzerSettings->WindowMs = Settings->WindowMs;
+	}
+	return AnalyzerSettings;
+}
+
+#if WITH_EDITOR
+void UOVRLipSyncNRT::PostLoad()
+{
+	Super::PostLoad();
+
+	// Analysis is kicked off once loading completes, it can't run from within PostLoad
+	TWeakObjectPtr<UOVRLipSyncNRT> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+		if (WeakThis.IsValid())
+		{
+			WeakThis->RefreshIfSoundChanged();
+		}
+	});
+}
+
+void UOVRLipSyncNRT::PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent)
+{
+	if (Sound && ShouldEventTriggerAnalysis(PropertyChangedEvent))
+	{
+		AnalyzedSoundGuid = Sound->CompressedDataGuid;
+	}
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+bool UOVRLipSyncNRT::ShouldEventTriggerAnalysis(FPropertyChangedEvent &PropertyChangeEvent)
+{
+	static const FName SettingsName = GET_MEMBER_NAME_CHECKED(UOVRLipSyncNRT, Settings);
+	if (PropertyChangeEvent.GetPropertyName() == SettingsName)
+	{
+		return true;
+	}
+	return Super::ShouldEventTriggerAnalysis(PropertyChangeEvent);
+}
+
+void UOVRLipSyncNRT::RefreshIfSoundChanged()
+{
+	if (!Sound || AnalyzedSoundGuid == Sound->CompressedDataGuid)
+	{
+		return;
+	}
+	FPropertyChangedEvent SoundChangedEvent(
+		FindFProperty<FProperty>(UAudioAnalyzerNRT::StaticClass(), GET_MEMBER_NAME_CHECKED(UAudioAnalyzerNRT, Sound)));
+	PostEditChangeProperty(SoundChangedEvent);
+}
+#endif
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncNRTFactory.cpp
+ * Content     :   OVRLipSync non-real-time analyzer factory
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "OVRLipSyncNRTFactory.h"
+
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace Audio
+{
+const FName FOVRLipSyncNRTFactory::Name = TEXT("OVRLipSyncNRTFactory");
+
+void FOVRLipSyncNRTResult::Serialize(FArchive &Archive)
+{
+	// Payload is length-prefixed, so results of other versions could be skipped without parsing them
+	int32 SerializedVersion = Version;
+	TArray<uint8> Payload;
+	if (Archive.IsSaving())
+	{
+		FMemoryWriter Writer(Payload);
+		Writer << Frames.Visemes;
+		Writer << Frames.LaughterScores;
+		Writer << FrameRate;
+		Writer << DurationInSeconds;
+	}
+	Archive << SerializedVersion;
+	Archive << Payload;
+	if (Archive.IsLoading())
+	{
+		Frames.Reset();
+		DurationInSeconds = 0.0f;
+		if (SerializedVersion != Version)
+		{
+			// Stale analysis is dropped, it is recomputed next time the sound is analyzed
+			return;
+		}
+		FMemoryReader Reader(Payload);
+		Reader << Frames.Visemes;
+		Reader << Frames.LaughterScores;
+		Reader << FrameRate;
+		Reader << DurationInSeconds;
+	}
+}
+
+FOVRLipSyncNRTWorker::FOVRLipSyncNRTWorker(const FAnalyzerNRTParameters &InParams,
+										   const FOVRLipSyncNRTSettings &InSettings)
+{
+	GenerationSettings.SampleRate = static_cast<int32>(InParams.SampleRate);
+	GenerationSettings.NumChannels = InParams.NumChannels;
+	GenerationSettings.HopMs = InSettings.HopMs;
+	GenerationSettings.WindowMs = InSettings.WindowMs;
+	GenerationSettings.ModelPath =
+		InSettings.bUseOfflineModel ? FOVRLipSyncGenerator::GetOfflineModelPath() : FString();
+}
+
+void FOVRLipSyncNRTWorker::Analyze(TArrayView<const float> InAudio, IAnalyzerNRTResult *OutResult)
+{
+	const auto Offset = PCMData.AddUninitialized(InAudio.Num());
+	for (int32 Idx = 0; Idx < InAudio.Num(); ++Idx)
+	{
+		PCMData[Offset + Idx] = static_cast<int16>(FMath::Clamp(InAudio[Idx], -1.0f, 1.0f) * MAX_int16);
+	}
+}
+
+void FOVRLipSyncNRTWorker::Finalize(IAnalyzerNRTResult *OutResult)
+{
+	auto Result = static_cast<FOVRLipSyncNRTResult *>(OutResult);
+	Result->Frames.Reset();
+	if (GenerationSettings.NumChannels < 1 || GenerationSettings.NumChannels > 2)
+	{
+		return;
+	}
+
+	FOVRLipSyncGenerator Generator(GenerationSettings);
+	Generator.Generate(PCMData.GetData(), PCMData.Num(), Result->Frames);
+	Result->FrameRate = Generator.GetFrameRate();
+	Result->DurationInSeconds =
+		static_cast<float>(PCMData.Num()) / (GenerationSettings.SampleRate * GenerationSettings.NumChannels);
+	PCMData.Empty();
+}
+
+TUniquePtr<IAnalyzerNRTResult> FOVRLipSyncNRTFactory::NewResult() const
+{
+	return MakeUnique<FOVRLipSyncNRTResult>();
+}
+
+TUniquePtr<IAnalyzerNRTWorker> FOVRLipSyncNRTFactory::NewWorker(const FAnalyzerNRTParameters &InParams,
+																const IAnalyzerNRTSettings *InSettings) const
+{
+	const FOVRLipSyncNRTSettings DefaultSettings;
+	const auto *Settings = InSettings ? static_cast<const FOVRLipSyncNRTSettings *>(InSettings) : &DefaultSettings;
+	return MakeUnique<FOVRLipSyncNRTWorker>(InParams, *Settings);
+}
+} // namespace Audio
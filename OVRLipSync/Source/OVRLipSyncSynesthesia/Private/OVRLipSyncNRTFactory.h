@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncNRTFactory.h
+ * Content     :   Prototypes for OVRLipSync non-real-time analyzer factory
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IAudioAnalyzerNRTInterface.h"
+#include "OVRLipSyncFrame.h"
+#include "OVRLipSyncGenerator.h"
+
+namespace Audio
+{
+class FOVRLipSyncNRTSettings : public IAnalyzerNRTSettings
+{
+public:
+	bool bUseOfflineModel = false;
+	float HopMs = 10.0f;
+	float WindowMs = 10.0f;
+};
+
+class FOVRLipSyncNRTResult : public IAnalyzerNRTResult
+{
+public:
+	// Bump whenever analysis or serialized layout changes, older results are discarded on load
+	static constexpr int32 Version = 1;
+
+	virtual void Serialize(FArchive &Archive) override;
+	virtual float GetDurationInSeconds() const override { return DurationInSeconds; }
+
+	FOVRLipSyncFrameData Frames;
+	float FrameRate = 100.0f;
+	float DurationInSeconds = 0.0f;
+};
+
+// Collects the whole sound and runs it through the shared generator on Finalize, so analysis
+// results match sequences generated from the same sound
+class FOVRLipSyncNRTWorker : public IAnalyzerNRTWorker
+{
+public:
+	FOVRLipSyncNRTWorker(const FAnalyzerNRTParameters &InParams, const FOVRLipSyncNRTSettings &InSettings);
+
+	virtual void Analyze(TArrayView<const float> InAudio, IAnalyzerNRTResult *OutResult) override;
+	virtual void Finalize(IAnalyzerNRTResult *OutResult) override;
+
+private:
+	FOVRLipSyncGenerationSettings GenerationSettings;
+	TArray<int16> PCMData;
+};
+
+class FOVRLipSyncNRTFactory : public IAnalyzerNRTFactory
+{
+public:
+	static const FName Name;
+
+	virtual FName GetName() const override { return Name; }
+	virtual FString GetTitle() const override { return TEXT("OVRLipSync Visemes"); }
+	virtual TUniquePtr<IAnalyzerNRTResult> NewResult() const override;
+	virtual TUniquePtr<IAnalyzerNRTWorker> NewWorker(const FAnalyzerNRTParameters &InParams,
+													 const IAnalyzerNRTSettings *InSettings) const override;
+};
+} // namespace Audio
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncSynesthesiaModule.cpp
+ * Content     :   OVRLipSync audio analyzer Module
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include "Features/IModularFeatures.h"
+#include "Modules/ModuleManager.h"
+#include "OVRLipSyncNRT.h"
+#include "OVRLipSyncNRTFactory.h"
+#include "Sound/SoundWave.h"
+#include "UObject/UObjectIterator.h"
+
+class FOVRLipSyncSynesthesiaModule : public IModuleInterface
+{
+public:
+	void StartupModule() override
+	{
+		IModularFeatures::Get().RegisterModularFeature(Audio::IAnalyzerNRTFactory::GetModularFeatureName(), &Factory);
+#if WITH_EDITOR
+		// Reimported sounds change their source data, refresh analyzers pointing at them
+		PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+			[](UObject *Object, FPropertyChangedEvent &) {
+				if (!Object->IsA<USoundWave>())
+				{
+					return;
+				}
+				for (TObjectIterator<UOVRLipSyncNRT> It; It; ++It)
+				{
+					if (It->Sound == Object)
+					{
+						It->RefreshIfSoundChanged();
+					}
+				}
+			});
+#endif
+	}
+
+	void ShutdownModule() override
+	{
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+#endif
+		IModularFeatures::Get().UnregisterModularFeature(Audio::IAnalyzerNRTFactory::GetModularFeatureName(),
+														 &Factory);
+	}
+
+private:
+	Audio::FOVRLipSyncNRTFactory Factory;
+	FDelegateHandle PropertyChangedHandle;
+};
+
+IMPLEMENT_MODULE(FOVRLipSyncSynesthesiaModule, OVRLipSyncSynesthesia);
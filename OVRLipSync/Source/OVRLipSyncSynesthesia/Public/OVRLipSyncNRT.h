@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Filename    :   OVRLipSyncNRT.h
+ * Content     :   Prototypes for OVRLipSync non-real-time audio analyzer
+ * Created     :   Oct 18th, 2026
+ * Copyright   :   Copyright Facebook Technologies, LLC and its affiliates.
+ *                 All rights reserved.
+ *
+ * Licensed under the Oculus Audio SDK License Version 3.3 (the "License");
+ * you may not use the Oculus Audio SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/audio-3.3/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus Audio SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#pragma once
+
+#include "AudioSynesthesiaNRT.h"
+#include "CoreMinimal.h"
+
+#include "OVRLipSyncNRT.generated.h"
+
+UCLASS(Blueprintable)
+class OVRLIPSYNCSYNESTHESIA_API UOVRLipSyncNRTSettings : public UAudioSynesthesiaNRTSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LipSync")
+	bool bUseOfflineModel = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LipSync", Meta = (ClampMin = "1.0", ClampMax = "100.0"))
+	float HopMs = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LipSync", Meta = (ClampMin = "1.0", ClampMax = "100.0"))
+	float WindowMs = 10.0f;
+};
+
+// Viseme analysis stored alongside the SoundWave by the audio analyzer framework.
+// Results are recomputed whenever the sound, its source data or the settings change.
+UCLASS(Blueprintable)
+class OVRLIPSYNCSYNESTHESIA_API UOVRLipSyncNRT : public UAudioSynesthesiaNRT
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AudioAnalyzer")
+	TObjectPtr<UOVRLipSyncNRTSettings> Settings;
+
+	UFUNCTION(BlueprintCallable, Category = "LipSync",
+			  Meta = (Tooltip = "Returns viseme and laughter scores at the given time, false if there is no analysis"))
+	bool GetVisemesAtTime(float InSeconds, TArray<float> &OutVisemes, float &OutLaughterScore) const;
+
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	float GetFrameRate() const;
+
+	virtual FName GetAnalyzerNRTFactoryName() const override;
+
+#if WITH_EDITOR
+	virtual void PostLoad() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+	virtual bool ShouldEventTriggerAnalysis(FPropertyChangedEvent &PropertyChangeEvent) override;
+
+	// Re-runs analysis if the source data of the sound changed since the last analysis
+	void RefreshIfSoundChanged();
+#endif
+
+protected:
+	virtual TUniquePtr<Audio::IAnalyzerNRTSettings> GetSettings(const float InSampleRate,
+																 const int32 InNumChannels) const override;
+
+private:
+#if WITH_EDITORONLY_DATA
+	// Source data of the sound the current result was computed for
+	UPROPERTY()
+	FGuid AnalyzedSoundGuid;
+#endif
+};